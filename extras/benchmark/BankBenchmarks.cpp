@@ -0,0 +1,134 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file BankBenchmarks.cpp 
+//!  @brief Benchmarks comparing individual LFO objects and LFOBank
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include "Benchmark.h"
+#include "SoftwareLFO.h"
+#include <list>
+#include <vector>
+
+template <size_t N>
+static void benchmarkBank()
+{
+    const unsigned long ticks = Benchmark::DefaultIterations / N;
+    char name[64];
+    std::vector<uint32_t> buffer(N);
+
+    //Individual objects are separately heap allocated as they would be in a real application
+    std::list<DeluxeSoftwareLFO<1>> storage;
+    std::vector<BaseDeluxeLFO *> objects;
+    LFOBank<N, 1> *bank = new LFOBank<N, 1>();
+    for (size_t i = 0; i < N; i++)
+    {
+        storage.emplace_back();
+        DeluxeSoftwareLFO<1> *lfo = &storage.back();
+        float freq = 0.1f + 0.01f * static_cast<float>(i);
+        LFOWaveform waveform = static_cast<LFOWaveform>(i % static_cast<size_t>(LFOWaveform::N_WAVEFORMS));
+        lfo->setFrequency(freq);
+        lfo->setWaveform(waveform);
+        bank->setFrequency(i, freq);
+        bank->setWaveform(i, waveform);
+        objects.push_back(lfo);
+    }
+
+    snprintf(name, sizeof(name), "N=%-5u objects tick()", static_cast<unsigned int>(N));
+    Benchmark::report(name, Benchmark::nsPerOp(ticks, [&]{
+        for (size_t i = 0; i < N; i++) objects[i]->tick();
+        Benchmark::keep(objects);
+    }) / N);
+
+    snprintf(name, sizeof(name), "N=%-5u bank tickAll()", static_cast<unsigned int>(N));
+    Benchmark::report(name, Benchmark::nsPerOp(ticks, [&]{
+        bank->tickAll();
+        Benchmark::keep(*bank);
+    }) / N);
+
+    snprintf(name, sizeof(name), "N=%-5u objects tick() + getValue()", static_cast<unsigned int>(N));
+    Benchmark::report(name, Benchmark::nsPerOp(ticks, [&]{
+        for (size_t i = 0; i < N; i++)
+        {
+            objects[i]->tick();
+            buffer[i] = objects[i]->getValue();
+        }
+        Benchmark::keep(buffer.data());
+    }) / N);
+
+    snprintf(name, sizeof(name), "N=%-5u bank tickAll() + renderAll()", static_cast<unsigned int>(N));
+    Benchmark::report(name, Benchmark::nsPerOp(ticks, [&]{
+        bank->tickAll();
+        bank->renderAll(buffer.data());
+        Benchmark::keep(buffer.data());
+    }) / N);
+
+    for (size_t i = 0; i < N; i++) bank->setDepth(i, LFOScaling::FullDepth / 2);
+    snprintf(name, sizeof(name), "N=%-5u bank tickAll() + renderAll() scaled", static_cast<unsigned int>(N));
+    Benchmark::report(name, Benchmark::nsPerOp(ticks, [&]{
+        bank->tickAll();
+        bank->renderAll(buffer.data());
+        Benchmark::keep(buffer.data());
+    }) / N);
+
+    delete bank;
+}
+
+void runBankBenchmarks()
+{
+    Benchmark::section("Individual objects vs LFOBank (per oscillator)");
+    benchmarkBank<8>();
+    benchmarkBank<64>();
+    benchmarkBank<1024>();
+}
@@ -0,0 +1,175 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file Benchmark.h 
+//!  @brief Host benchmark helpers
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef _SOFTWARE_LFO_BENCHMARK_H_
+#define _SOFTWARE_LFO_BENCHMARK_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <chrono>
+
+namespace Benchmark
+{
+    /**
+     * @brief Number of operations timed by each measurement
+     */
+    static constexpr unsigned long DefaultIterations = 10000000UL;
+
+    /**
+     * @brief Prevent the compiler from optimizing away a computed value
+     * 
+     * @param value The value to keep
+     */
+    template <typename T>
+    inline void keep(const T &value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    /**
+     * @brief Hide a pointer from the optimizer (prevents devirtualization and constant folding)
+     * 
+     * @param pointer The pointer to hide
+     * @return T* The same pointer
+     */
+    template <typename T>
+    inline T *opaque(T *pointer)
+    {
+        asm volatile("" : "+r"(pointer));
+        return pointer;
+    }
+
+    /**
+     * @brief Time a function and return the average cost of one call
+     * 
+     * @param iterations The number of calls to time
+     * @param func The function to time
+     * @return double The average time per call in nanoseconds
+     */
+    template <typename FUNC>
+    inline double nsPerOp(unsigned long iterations, FUNC func)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned long i = 0; i < iterations; i++) func();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(iterations);
+    }
+
+    /**
+     * @brief Number of failed checks so far
+     * 
+     * @return unsigned long& The failure count
+     */
+    inline unsigned long &failures()
+    {
+        static unsigned long count = 0;
+        return count;
+    }
+
+    /**
+     * @brief Check a result the benchmarks rely on (a failed check makes the benchmark exit with an error)
+     * 
+     * @param passed Whether the check passed
+     * @param description What was checked
+     */
+    inline void check(bool passed, const char *description)
+    {
+        if (passed) return;
+        printf("  FAILED: %s\n", description);
+        failures()++;
+    }
+
+    /**
+     * @brief Print a section heading
+     * 
+     * @param title The section title
+     */
+    inline void section(const char *title)
+    {
+        printf("\n== %s ==\n", title);
+    }
+
+    /**
+     * @brief Print a single ns/op result
+     * 
+     * @param name The name of the measured operation
+     * @param ns The average time per operation in nanoseconds
+     */
+    inline void report(const char *name, double ns)
+    {
+        printf("  %-48s %10.3f ns/op %14.0f ops/s\n", name, ns, 1e9 / ns);
+    }
+}
+
+void runCoreBenchmarks();
+void runRenderBenchmarks();
+void runBankBenchmarks();
+void runFrequencyBenchmarks();
+void runTableBenchmarks();
+void runInterpolationBenchmarks();
+void runSchedulerBenchmarks();
+void runParameterBenchmarks();
+void runRenderEngineBenchmarks();
+void runCacheBenchmarks();
+void runOutputBenchmarks();
+void runStreamBenchmarks();
+void runGlideBenchmarks();
+void runPrecisionBenchmarks();
+void runSyncBenchmarks();
+
+#endif
@@ -0,0 +1,79 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file BenchmarkMain.cpp 
+//!  @brief Host benchmark entry point
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include "Benchmark.h"
+
+int main()
+{
+    runCoreBenchmarks();
+    runRenderBenchmarks();
+    runBankBenchmarks();
+    runFrequencyBenchmarks();
+    runTableBenchmarks();
+    runInterpolationBenchmarks();
+    runSchedulerBenchmarks();
+    runParameterBenchmarks();
+    runRenderEngineBenchmarks();
+    runCacheBenchmarks();
+    runOutputBenchmarks();
+    runStreamBenchmarks();
+    runGlideBenchmarks();
+    runPrecisionBenchmarks();
+    runSyncBenchmarks();
+    return (Benchmark::failures() == 0) ? 0 : 1;
+}
@@ -0,0 +1,128 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file CacheBenchmarks.cpp 
+//!  @brief Benchmarks for CachedLFO (lazy and eager output caching)
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include "Benchmark.h"
+#include "SoftwareLFO.h"
+#include "CachedLFO.h"
+
+//One tick followed by READERS getValue() calls through a BaseLFO pointer (as a consumer holding the LFO would)
+template <class LFO>
+static double timeReaders(LFO &object, unsigned int readers)
+{
+    LFO *lfo = Benchmark::opaque(&object);
+    BaseLFO *reader = Benchmark::opaque(static_cast<BaseLFO *>(&object));
+    return Benchmark::nsPerOp(Benchmark::DefaultIterations / 4, [&]{
+        lfo->tick();
+        for (unsigned int r = 0; r < readers; r++) Benchmark::keep(reader->getValue());
+    });
+}
+
+template <class LFO>
+static void configure(LFO &lfo)
+{
+    lfo.setFrequency(3.7f);
+    lfo.setWaveform(LFOWaveform::AsymmetricSine);
+    lfo.setPolarity(LFOPolarity::Bipolar);
+    lfo.setOffset(LFOScaling::Center);
+    lfo.setDepth(LFOScaling::FullDepth / 2);
+}
+
+template <class LFO>
+static void benchmarkConfiguration(const char *name)
+{
+    LFO plain;
+    CachedLFO<LFO, LFOCacheMode::Lazy> lazy;
+    CachedLFO<LFO, LFOCacheMode::Eager> eager;
+    configure(plain);
+    configure(lazy);
+    configure(eager);
+
+    const unsigned int readerCounts[] = { 0, 1, 4 };
+    for (unsigned int readers : readerCounts)
+    {
+        printf("  %s, tick() + %u getValue() calls\n", name, readers);
+        Benchmark::report("  uncached", timeReaders(plain, readers));
+        Benchmark::report("  CachedLFO Lazy", timeReaders(lazy, readers));
+        Benchmark::report("  CachedLFO Eager", timeReaders(eager, readers));
+    }
+
+    //The cached values must match the uncached ones
+    unsigned long mismatches = 0;
+    for (unsigned long i = 0; i < 100000; i++)
+    {
+        plain.tick();
+        lazy.tick();
+        eager.tick();
+        if (i == 50000)
+        {
+            plain.setWaveform(LFOWaveform::Square);
+            lazy.setWaveform(LFOWaveform::Square);
+            eager.setWaveform(LFOWaveform::Square);
+        }
+        uint32_t expected = plain.getValue();
+        if (lazy.getValue() != expected || lazy.getValue() != expected || eager.getValue() != expected) mismatches++;
+    }
+    printf("    mismatches vs uncached: %lu\n", mismatches);
+}
+
+void runCacheBenchmarks()
+{
+    Benchmark::section("CachedLFO (per tick)");
+    benchmarkConfiguration<DeluxeSoftwareLFO<1>>("EightBitWaveforms linear");
+    benchmarkConfiguration<DeluxeSoftwareLFO<1, SixteenBitWaveforms, HermiteInterpolation>>("SixteenBitWaveforms hermite");
+}
@@ -0,0 +1,157 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file CoreBenchmarks.cpp 
+//!  @brief Benchmarks for the basic LFO operations
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include "Benchmark.h"
+#include "SoftwareLFO.h"
+#include "ClockedLFO.h"
+
+static const char *waveformName(LFOWaveform waveform)
+{
+    switch(waveform)
+    {
+        case LFOWaveform::Triangle: return "Triangle";
+        case LFOWaveform::Square: return "Square";
+        case LFOWaveform::Sawtooth: return "Sawtooth";
+        case LFOWaveform::AsymmetricSine: return "AsymmetricSine";
+        case LFOWaveform::InvertedAsymmetricSine: return "InvertedAsymmetricSine";
+        case LFOWaveform::CompoundSine: return "CompoundSine";
+        default: return "Sine";
+    }
+}
+
+void runCoreBenchmarks()
+{
+    const unsigned long n = Benchmark::DefaultIterations;
+    char name[64];
+
+    Benchmark::section("Core operations");
+
+    DeluxeSoftwareLFO<1> deluxe;
+    deluxe.setFrequency(3.7f);
+    BaseDeluxeLFO *lfo = Benchmark::opaque(static_cast<BaseDeluxeLFO *>(&deluxe));
+
+    Benchmark::report("tick()", Benchmark::nsPerOp(n, [&]{
+        lfo->tick();
+        Benchmark::keep(*lfo);
+    }));
+
+    SoftwareLFO<1> basic;
+    basic.setFrequency(3.7f);
+    basic.setCounter(0x123456);
+    BaseLFO *sine = Benchmark::opaque(static_cast<BaseLFO *>(&basic));
+    Benchmark::report("getValue() SoftwareLFO", Benchmark::nsPerOp(n, [&]{
+        Benchmark::keep(sine->getValue());
+    }));
+
+    for (unsigned int w = 0; w < static_cast<unsigned int>(LFOWaveform::N_WAVEFORMS); w++)
+    {
+        LFOWaveform waveform = static_cast<LFOWaveform>(w);
+        lfo->setWaveform(waveform);
+        lfo->setCounter(0x123456);
+        snprintf(name, sizeof(name), "getValue() %s", waveformName(waveform));
+        Benchmark::report(name, Benchmark::nsPerOp(n, [&]{
+            Benchmark::keep(lfo->getValue());
+        }));
+    }
+
+    lfo->setWaveform(LFOWaveform::Sine);
+    Benchmark::report("tick() + getValue()", Benchmark::nsPerOp(n, [&]{
+        lfo->tick();
+        Benchmark::keep(lfo->getValue());
+    }));
+
+    float freq = 0.1f;
+    DeluxeSoftwareLFO<1> *typed = Benchmark::opaque(&deluxe);
+    Benchmark::report("setFrequency()", Benchmark::nsPerOp(n, [&]{
+        typed->setFrequency(freq);
+        freq += 0.001f;
+        Benchmark::keep(*typed);
+    }));
+
+    //Catching up after a 1000 tick stall
+    Benchmark::report("1000 x tick()", Benchmark::nsPerOp(n / 1000, [&]{
+        for (unsigned int i = 0; i < 1000; i++)
+        {
+            lfo->tick();
+            Benchmark::keep(*lfo);
+        }
+    }));
+
+    uint32_t ticks = 1000;
+    Benchmark::report("advance(1000)", Benchmark::nsPerOp(n, [&]{
+        typed->advance(Benchmark::opaque(&ticks)[0]);
+        Benchmark::keep(*typed);
+    }));
+
+    ClockedLFO<SoftwareLFOHz<44100>> audio;
+    audio.setFrequency(3.7f);
+    ClockedLFO<SoftwareLFOHz<44100>> *clocked = Benchmark::opaque(&audio);
+    uint32_t now = 0;
+    Benchmark::report("update(nowMs) ClockedLFO<SoftwareLFOHz<44100>>", Benchmark::nsPerOp(n, [&]{
+        now += 3;
+        clocked->update(now);
+        Benchmark::keep(*clocked);
+    }));
+
+    unsigned int w = 0;
+    Benchmark::report("setWaveform()", Benchmark::nsPerOp(n, [&]{
+        lfo->setWaveform(static_cast<LFOWaveform>(w));
+        w = (w + 1) % static_cast<unsigned int>(LFOWaveform::N_WAVEFORMS);
+        Benchmark::keep(*lfo);
+    }));
+}
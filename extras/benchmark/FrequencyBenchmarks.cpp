@@ -0,0 +1,284 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file FrequencyBenchmarks.cpp 
+//!  @brief Benchmarks and accuracy checks for the float and integer frequency paths
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include "Benchmark.h"
+#include "SoftwareLFO.h"
+#include <math.h>
+
+/**
+ * @brief Compare the integer only increment calculations against exact values and the float path
+ */
+template <class CALCULATOR>
+static void checkAccuracy(const char *name)
+{
+    const double multiplier = ldexp(1.0, CALCULATOR::CounterBitDepth) * static_cast<double>(CALCULATOR::TickNumerator) /
+                              static_cast<double>(CALCULATOR::TickDenominator);
+    double maxFreqError = 0, maxFreqVsFloat = 0, maxPeriodError = 0, maxPeriodVsFloat = 0;
+
+    //Sweep frequencies logarithmically over the supported range
+    for (double mHz = 1; mHz <= CALCULATOR::MaxFrequencyMilliHz; mHz *= 1.0013)
+    {
+        uint32_t freq = static_cast<uint32_t>(mHz);
+        double exact = floor(freq * multiplier / 1000.0);
+        if (exact < 1) continue;
+        double integer = CALCULATOR::getIncrementValueForFrequencyMilliHz(freq);
+        double single = CALCULATOR::getIncrementValueForFrequency(freq / 1000.f);
+        maxFreqError = fmax(maxFreqError, fabs(integer - exact));
+        maxFreqVsFloat = fmax(maxFreqVsFloat, fabs(integer - single));
+    }
+
+    for (double ms = CALCULATOR::MinPeriodMs; ms < 1e9; ms *= 1.0013)
+    {
+        uint32_t period = static_cast<uint32_t>(ms);
+        double exact = floor(multiplier * 1000.0 / period);
+        if (exact < 1 || exact > CALCULATOR::MaxIncrementValue) continue;
+        double integer = CALCULATOR::getIncrementValueForPeriodMs(period);
+        double single = CALCULATOR::getIncrementValueForPeriod(period / 1000.f);
+        maxPeriodError = fmax(maxPeriodError, fabs(integer - exact));
+        maxPeriodVsFloat = fmax(maxPeriodVsFloat, fabs(integer - single));
+    }
+
+    printf("  %-28s freq: %4.0f LSB (float path %6.0f LSB)  period: %4.0f LSB (float path %6.0f LSB)\n",
+           name, maxFreqError, maxFreqVsFloat, maxPeriodError, maxPeriodVsFloat);
+}
+
+/**
+ * @brief Compare getIncrementValueForOctave() against exp2() over the whole MinFrequency to MaxFrequency range
+ */
+template <class CALCULATOR>
+static void checkOctaveAccuracy(const char *name)
+{
+    const double multiplier = ldexp(1.0, CALCULATOR::CounterBitDepth) * static_cast<double>(CALCULATOR::TickNumerator) /
+                              static_cast<double>(CALCULATOR::TickDenominator);
+    const int32_t one = 1L << CALCULATOR::OctaveBits;
+    const int32_t lowest = static_cast<int32_t>(floor(log2(CALCULATOR::MinFrequency) * one));
+    const int32_t highest = static_cast<int32_t>(ceil(log2(CALCULATOR::MaxFrequency) * one));
+    double maxRelative = 0, maxLSB = 0;
+    unsigned long points = 0;
+    for (int32_t octaves = lowest; octaves <= highest; octaves += 7)
+    {
+        double exact = multiplier * exp2(static_cast<double>(octaves) / one);
+        if (exact < 1 || exact > CALCULATOR::MaxIncrementValue) continue;
+        double table = CALCULATOR::getIncrementValueForOctave(octaves);
+        double error = fabs(table - exact);
+        maxLSB = fmax(maxLSB, error);
+        //Relative error where the increment is large enough for its own rounding not to dominate
+        if (exact >= 65536) maxRelative = fmax(maxRelative, error / exact);
+        points++;
+    }
+    printf("  %-28s %5.1f octaves, %8lu points: max error %.5f%% (%.0f LSB)\n",
+           name, static_cast<double>(highest - lowest) / one, points, maxRelative * 100.0, maxLSB);
+}
+
+/**
+ * @brief Compare RuntimeLFOCalculator against the compile time calculator for the same tick period
+ */
+template <class CALCULATOR>
+static void checkRuntimeCalculator(const char *name)
+{
+    RuntimeLFOCalculator<CALCULATOR::CounterBitDepth> runtime(CALCULATOR::TickNumerator, CALCULATOR::TickDenominator);
+    unsigned long points = 0, mismatches = 0;
+    for (double mHz = 1; mHz <= CALCULATOR::MaxFrequencyMilliHz; mHz *= 1.01)
+    {
+        uint32_t freq = static_cast<uint32_t>(mHz);
+        mismatches += CALCULATOR::getIncrementValueForFrequencyMilliHz(freq) != runtime.getIncrementValueForFrequencyMilliHz(freq);
+        mismatches += CALCULATOR::getIncrementValueForFrequency(freq / 1000.f) != runtime.getIncrementValueForFrequency(freq / 1000.f);
+        mismatches += CALCULATOR::getIncrementValueForPeriodMs(freq) != runtime.getIncrementValueForPeriodMs(freq);
+        points += 3;
+    }
+    for (int32_t octaves = -20 * 65536L; octaves <= 20 * 65536L; octaves += 997)
+    {
+        mismatches += CALCULATOR::getIncrementValueForOctave(octaves) != runtime.getIncrementValueForOctave(octaves);
+        points++;
+    }
+    mismatches += CALCULATOR::TicksPerMsNumerator != runtime.getTicksPerMsNumerator();
+    mismatches += CALCULATOR::TicksPerMsDenominator != runtime.getTicksPerMsDenominator();
+    printf("  %-28s %8lu points, %lu mismatches\n", name, points, mismatches);
+}
+
+void runFrequencyBenchmarks()
+{
+    const unsigned long n = Benchmark::DefaultIterations;
+
+    Benchmark::section("Float vs integer frequency calculation");
+
+    DeluxeSoftwareLFO<1> deluxe;
+    DeluxeSoftwareLFO<1> *lfo = Benchmark::opaque(&deluxe);
+
+    float freq = 0.1f;
+    Benchmark::report("setFrequency(float)", Benchmark::nsPerOp(n, [&]{
+        lfo->setFrequency(freq);
+        freq += 0.001f;
+        Benchmark::keep(*lfo);
+    }));
+
+    uint32_t milliHz = 100;
+    Benchmark::report("setFrequencyMilliHz(uint32_t)", Benchmark::nsPerOp(n, [&]{
+        lfo->setFrequencyMilliHz(milliHz);
+        milliHz = (milliHz + 1) & 0x3FFFF;
+        Benchmark::keep(*lfo);
+    }));
+
+    float period = 0.1f;
+    Benchmark::report("setPeriod(float)", Benchmark::nsPerOp(n, [&]{
+        lfo->setPeriod(period);
+        period += 0.001f;
+        Benchmark::keep(*lfo);
+    }));
+
+    uint32_t periodMs = 2;
+    Benchmark::report("setPeriodMs(uint32_t)", Benchmark::nsPerOp(n, [&]{
+        lfo->setPeriodMs(periodMs);
+        periodMs = (periodMs + 1) & 0x3FFFF;
+        Benchmark::keep(*lfo);
+    }));
+
+    //The period division on its own: native 64 bit division vs the 32 bit long division used without one
+    typedef LFOIncrementMath<LFOCounter::PhaseBitDepth> Math;
+    uint64_t dividend = DeluxeSoftwareLFO<1>::PeriodMsToCountDividend;
+    uint64_t *dividendPtr = Benchmark::opaque(&dividend);
+    periodMs = 2;
+    Benchmark::report("period division, 64 bit", Benchmark::nsPerOp(n, [&]{
+        Benchmark::keep(static_cast<uint32_t>(*dividendPtr / periodMs));
+        periodMs = (periodMs & 0x3FFFF) + 1;
+    }));
+    periodMs = 2;
+    Benchmark::report("period division, 32 bit longDivide()", Benchmark::nsPerOp(n, [&]{
+        Benchmark::keep(Math::longDivide(*dividendPtr, periodMs));
+        periodMs = (periodMs & 0x3FFFF) + 1;
+    }));
+    float periodFloat = 2.0f;
+    Benchmark::report("period division, float", Benchmark::nsPerOp(n, [&]{
+        Benchmark::keep(static_cast<uint32_t>(4294967296.f / periodFloat));
+        periodFloat += 1.0f;
+    }));
+
+    int32_t octaves = -4 * 65536L;
+    Benchmark::report("setFrequencyExp(int32_t)", Benchmark::nsPerOp(n, [&]{
+        lfo->setFrequencyExp(octaves);
+        octaves = (octaves + 37) & 0x7FFFF;
+        Benchmark::keep(*lfo);
+    }));
+
+    float knob = 0.0f;
+    Benchmark::report("setFrequency(powf(2, x))", Benchmark::nsPerOp(n, [&]{
+        lfo->setFrequency(powf(2.0f, knob));
+        knob = (knob > 8.0f) ? -4.0f : knob + 0.0005f;
+        Benchmark::keep(*lfo);
+    }));
+
+    RuntimeDeluxeSoftwareLFO<> runtimeLFO(1);
+    RuntimeDeluxeSoftwareLFO<> *rt = Benchmark::opaque(&runtimeLFO);
+    freq = 0.1f;
+    Benchmark::report("RuntimeDeluxeSoftwareLFO::setFrequency(float)", Benchmark::nsPerOp(n, [&]{
+        rt->setFrequency(freq);
+        freq += 0.001f;
+        Benchmark::keep(*rt);
+    }));
+
+    milliHz = 100;
+    Benchmark::report("RuntimeDeluxeSoftwareLFO::setFrequencyMilliHz()", Benchmark::nsPerOp(n, [&]{
+        rt->setFrequencyMilliHz(milliHz);
+        milliHz = (milliHz + 1) & 0x3FFFF;
+        Benchmark::keep(*rt);
+    }));
+
+    uint32_t rate = 1;
+    Benchmark::report("RuntimeDeluxeSoftwareLFO::setTickRateMs()", Benchmark::nsPerOp(n / 100, [&]{
+        rt->setTickRateMs(rate);
+        rate = (rate & 63) + 1;
+        Benchmark::keep(*rt);
+    }));
+
+    Benchmark::section("RuntimeLFOCalculator vs compile time calculator");
+    checkRuntimeCalculator<LFOCalculator<1, LFOCounter::PhaseBitDepth>>("LFOCalculator<1>");
+    checkRuntimeCalculator<LFOCalculator<10, LFOCounter::PhaseBitDepth>>("LFOCalculator<10>");
+    checkRuntimeCalculator<LFOCalculator<1000, LFOCounter::PhaseBitDepth>>("LFOCalculator<1000>");
+    checkRuntimeCalculator<LFOCalculatorHz<48000, LFOCounter::PhaseBitDepth>>("LFOCalculatorHz<48000>");
+    checkRuntimeCalculator<LFOCalculatorUs<500, LFOCounter::PhaseBitDepth>>("LFOCalculatorUs<500>");
+    checkRuntimeCalculator<LFOCalculator<1>>("LFOCalculator<1> (24 bit)");
+
+    //Changing the tick rate keeps the phase and the frequency
+    RuntimeSoftwareLFO<> changing(10);
+    changing.setFrequencyMilliHz(1500);
+    for (int i = 0; i < 37; i++) changing.tick();
+    uint32_t phase = changing.getPhase();
+    uint32_t before = changing.getPhaseIncrement();
+    changing.setTickRateUs(2500);
+    RuntimeSoftwareLFO<> reference(1);
+    reference.setTickRateUs(2500);
+    reference.setFrequencyMilliHz(1500);
+    printf("  setTickRateUs(2500) from 10 ms: phase %s, increment %lu -> %lu (direct %lu)\n",
+           (changing.getPhase() == phase) ? "kept" : "CHANGED", static_cast<unsigned long>(before),
+           static_cast<unsigned long>(changing.getPhaseIncrement()), static_cast<unsigned long>(reference.getPhaseIncrement()));
+
+    Benchmark::section("Integer path error vs exact increment (and vs float path)");
+    checkAccuracy<LFOCalculator<1, LFOCounter::PhaseBitDepth>>("LFOCalculator<1>");
+    checkAccuracy<LFOCalculator<10, LFOCounter::PhaseBitDepth>>("LFOCalculator<10>");
+    checkAccuracy<LFOCalculator<1000, LFOCounter::PhaseBitDepth>>("LFOCalculator<1000>");
+    checkAccuracy<LFOCalculatorHz<48000, LFOCounter::PhaseBitDepth>>("LFOCalculatorHz<48000>");
+    checkAccuracy<LFOCalculatorUs<500, LFOCounter::PhaseBitDepth>>("LFOCalculatorUs<500>");
+    checkAccuracy<LFOCalculator<1>>("LFOCalculator<1> (24 bit)");
+
+    Benchmark::section("setFrequencyExp() error vs exp2() from MinFrequency to MaxFrequency");
+    checkOctaveAccuracy<LFOCalculator<1, LFOCounter::PhaseBitDepth>>("LFOCalculator<1>");
+    checkOctaveAccuracy<LFOCalculator<1000, LFOCounter::PhaseBitDepth>>("LFOCalculator<1000>");
+    checkOctaveAccuracy<LFOCalculatorHz<48000, LFOCounter::PhaseBitDepth>>("LFOCalculatorHz<48000>");
+    checkOctaveAccuracy<LFOCalculatorUs<500, LFOCounter::PhaseBitDepth>>("LFOCalculatorUs<500>");
+    checkOctaveAccuracy<LFOCalculator<1>>("LFOCalculator<1> (24 bit)");
+}
@@ -0,0 +1,146 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file GlideBenchmarks.cpp 
+//!  @brief Benchmarks for frequency glides
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include "Benchmark.h"
+#include "SoftwareLFO.h"
+#include "GlidingLFO.h"
+#include <math.h>
+
+typedef GlidingLFO<DeluxeSoftwareLFOHz<1000>> GlideLFO;
+
+/**
+ * @brief Glide for timeMs and compare every tick's increment with the ideal curve
+ */
+static void reportAccuracy(const char *name, float from, float to, uint32_t timeMs, LFOGlideShape shape)
+{
+    GlideLFO lfo;
+    lfo.setFrequency(from);
+    const double start = lfo.getPhaseIncrement();
+    lfo.glideToFrequency(to, timeMs, shape);
+    const double end = lfo.getIncrementValueForFrequency(to);
+    double worst = 0;
+    unsigned long ticks = 0;
+    while (lfo.isGliding())
+    {
+        double t = static_cast<double>(ticks) / timeMs;
+        double ideal = (shape == LFOGlideShape::Linear) ? start + (end - start) * t : start * pow(end / start, t);
+        double error = fabs(lfo.getPhaseIncrement() - ideal) / ideal * 100.0;
+        if (error > worst) worst = error;
+        lfo.tick();
+        ticks++;
+    }
+    printf("  %-36s %5lu ticks (expected %lu), final increment %s, worst error %.4f%%\n", name, ticks, 
+           static_cast<unsigned long>(timeMs), (lfo.getPhaseIncrement() == static_cast<uint32_t>(end)) ? "exact" : "WRONG", worst);
+}
+
+void runGlideBenchmarks()
+{
+    Benchmark::section("Frequency glide (1 kHz tick rate)");
+
+    DeluxeSoftwareLFOHz<1000> plain;
+    plain.setFrequency(1.0f);
+    DeluxeSoftwareLFOHz<1000> *plainLFO = Benchmark::opaque(&plain);
+    Benchmark::report("tick() without GlidingLFO", Benchmark::nsPerOp(Benchmark::DefaultIterations, [&]{
+        plainLFO->tick();
+        Benchmark::keep(plainLFO->getPhase());
+    }));
+    GlideLFO steady, gliding;
+    steady.setFrequency(1.0f);
+    gliding.setFrequency(1.0f);
+    GlideLFO *steadyLFO = Benchmark::opaque(&steady);
+    GlideLFO *glidingLFO = Benchmark::opaque(&gliding);
+    Benchmark::report("tick() not gliding", Benchmark::nsPerOp(Benchmark::DefaultIterations, [&]{
+        steadyLFO->tick();
+        Benchmark::keep(steadyLFO->getPhase());
+    }));
+    gliding.glideToFrequency(100.0f, 0xFFFFFFFFUL / 1000, LFOGlideShape::Exponential);
+    Benchmark::report("tick() gliding", Benchmark::nsPerOp(Benchmark::DefaultIterations, [&]{
+        glidingLFO->tick();
+        Benchmark::keep(glidingLFO->getPhase());
+    }));
+    Benchmark::report("glideToFrequency() linear", Benchmark::nsPerOp(Benchmark::DefaultIterations / 10, [&]{
+        glidingLFO->glideToFrequency(2.0f, 500, LFOGlideShape::Linear);
+        Benchmark::keep(glidingLFO->getPhaseIncrement());
+    }));
+    Benchmark::report("glideToFrequency() exponential", Benchmark::nsPerOp(Benchmark::DefaultIterations / 10, [&]{
+        glidingLFO->glideToFrequency(2.0f, 500, LFOGlideShape::Exponential);
+        Benchmark::keep(glidingLFO->getPhaseIncrement());
+    }));
+
+    reportAccuracy("linear 1 Hz to 5 Hz in 2 s", 1.0f, 5.0f, 2000, LFOGlideShape::Linear);
+    reportAccuracy("linear 20 Hz to 0.1 Hz in 1 s", 20.0f, 0.1f, 1000, LFOGlideShape::Linear);
+    reportAccuracy("exponential 1 Hz to 5 Hz in 2 s", 1.0f, 5.0f, 2000, LFOGlideShape::Exponential);
+    reportAccuracy("exponential 20 Hz to 0.1 Hz in 1 s", 20.0f, 0.1f, 1000, LFOGlideShape::Exponential);
+
+    //advance() and update() must follow a glide exactly like tick()
+    GlideLFO ticked, advanced;
+    ticked.setFrequency(0.5f);
+    advanced.setFrequency(0.5f);
+    ticked.glideToFrequency(40.0f, 3000, LFOGlideShape::Exponential);
+    advanced.glideToFrequency(40.0f, 3000, LFOGlideShape::Exponential);
+    unsigned long mismatches = 0;
+    for (uint32_t step = 1; step < 200; step += 7)
+    {
+        for (uint32_t i = 0; i < step; i++) ticked.tick();
+        advanced.advance(step);
+        if ((ticked.getPhase() != advanced.getPhase()) || (ticked.getPhaseIncrement() != advanced.getPhaseIncrement())) mismatches++;
+    }
+    printf("  advance() mismatches vs tick() during a glide: %lu\n", mismatches);
+    printf("  sizeof: %u bytes plain, %u bytes with GlidingLFO\n", 
+           static_cast<unsigned int>(sizeof(DeluxeSoftwareLFOHz<1000>)), static_cast<unsigned int>(sizeof(GlideLFO)));
+}
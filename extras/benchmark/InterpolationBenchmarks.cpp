@@ -0,0 +1,140 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file InterpolationBenchmarks.cpp 
+//!  @brief Benchmarks and error measurements for the interpolation policies
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#include "Benchmark.h"
+#include "SoftwareLFO.h"
+#include <math.h>
+
+/**
+ * @brief Time one interpolation policy and measure its error and smoothness on a sine table
+ * 
+ * The error is the worst case difference from the ideal sine wave.  The 
+ * roughness is the largest change in slope between consecutive output 
+ * values 1/65536 of a cycle apart: corners and steps in the output show 
+ * up as large slope changes (the ideal sine wave is below 0.1 LSB).
+ * 
+ * @param name The name printed in the report
+ */
+template <class WAVEFORMS, class INTERPOLATION>
+static void benchmarkInterpolation(const char *name)
+{
+    const unsigned long n = Benchmark::DefaultIterations;
+    typename WAVEFORMS::Table table = Benchmark::opaque(WAVEFORMS::getTable(LFOWaveform::Sine));
+
+    uint32_t phase = 0x12345678;
+    double ns = Benchmark::nsPerOp(n, [&]{
+        phase = phase * 1664525UL + 1013904223UL;
+        Benchmark::keep(INTERPOLATION::template interpolate<WAVEFORMS>(table, phase));
+    });
+
+    //The sine tables hold round(2^(bits-1) + (2^(bits-1) - 1) * sin(x)), scaled to the 24 bit output
+    const double center = ldexp(1.0, WAVEFORMS::SampleBits - 1);
+    const double scale = ldexp(1.0, 24 - WAVEFORMS::SampleBits);
+    double maxError = 0;
+    double maxSlopeChange = 0;
+    double previous = 0;
+    double previousSlope = 0;
+    for (uint32_t step = 0; step <= 0x10000UL; step++)
+    {
+        uint32_t p = step << 16;
+        double value = static_cast<double>(INTERPOLATION::template interpolate<WAVEFORMS>(table, p));
+        double ideal = (center + (center - 1) * sin(2.0 * M_PI * p / 4294967296.0)) * scale;
+        maxError = fmax(maxError, fabs(value - ideal));
+        double slope = value - previous;
+        if (step > 1) maxSlopeChange = fmax(maxSlopeChange, fabs(slope - previousSlope));
+        previous = value;
+        previousSlope = slope;
+    }
+    printf("  %-40s %7.3f ns/op  max error %8.1f LSB  max slope change %8.1f LSB\n", name, ns, maxError, maxSlopeChange);
+}
+
+void runInterpolationBenchmarks()
+{
+    Benchmark::section("Interpolation policies (sine, 24 bit LSB)");
+    benchmarkInterpolation<EightBitWaveforms, TruncatingInterpolation>("EightBit Truncating");
+    benchmarkInterpolation<EightBitWaveforms, LinearInterpolation>("EightBit Linear");
+    benchmarkInterpolation<EightBitWaveforms, HermiteInterpolation>("EightBit Hermite");
+    benchmarkInterpolation<EightBitQuarterSine, TruncatingInterpolation>("EightBitQuarterSine Truncating");
+    benchmarkInterpolation<EightBitQuarterSine, LinearInterpolation>("EightBitQuarterSine Linear");
+    benchmarkInterpolation<EightBitQuarterSine, HermiteInterpolation>("EightBitQuarterSine Hermite");
+    benchmarkInterpolation<SixteenBitWaveforms, TruncatingInterpolation>("SixteenBit Truncating");
+    benchmarkInterpolation<SixteenBitWaveforms, LinearInterpolation>("SixteenBit Linear");
+    benchmarkInterpolation<SixteenBitWaveforms, HermiteInterpolation>("SixteenBit Hermite");
+    benchmarkInterpolation<WaveformTables<16, 256>, LinearInterpolation>("WaveformTables<16, 256> Linear");
+    benchmarkInterpolation<WaveformTables<16, 256>, HermiteInterpolation>("WaveformTables<16, 256> Hermite");
+
+    //Per-sample cost of rendering a block with each policy
+    const size_t blockSize = 256;
+    uint32_t buffer[blockSize];
+    DeluxeSoftwareLFO<1, EightBitWaveforms, TruncatingInterpolation> truncating;
+    DeluxeSoftwareLFO<1, EightBitWaveforms, LinearInterpolation> linear;
+    DeluxeSoftwareLFO<1, EightBitWaveforms, HermiteInterpolation> hermite;
+    truncating.setFrequency(3.7f);
+    linear.setFrequency(3.7f);
+    hermite.setFrequency(3.7f);
+    BaseLFO *lfos[] = { Benchmark::opaque(static_cast<BaseLFO *>(&truncating)), 
+                        Benchmark::opaque(static_cast<BaseLFO *>(&linear)), 
+                        Benchmark::opaque(static_cast<BaseLFO *>(&hermite)) };
+    const char *names[] = { "Truncating tickAndRender() per sample", "Linear tickAndRender() per sample", "Hermite tickAndRender() per sample" };
+    for (unsigned int i = 0; i < 3; i++)
+    {
+        Benchmark::report(names[i], Benchmark::nsPerOp(Benchmark::DefaultIterations / blockSize, [&]{
+            lfos[i]->tickAndRender(buffer, blockSize);
+            Benchmark::keep(buffer);
+        }) / blockSize);
+    }
+}
@@ -0,0 +1,157 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file OutputBenchmarks.cpp 
+//!  @brief Benchmarks for the DAC/PWM output formats and dithering
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include "Benchmark.h"
+#include "SoftwareLFO.h"
+#include <math.h>
+
+static constexpr size_t BlockSize = 256;
+
+template <class DITHER>
+static double timeRenderOutput(BasicDeluxeLFO<EightBitWaveforms> *lfo, DITHER &dither)
+{
+    uint16_t buffer[BlockSize];
+    return Benchmark::nsPerOp(Benchmark::DefaultIterations / BlockSize, [&]{
+        lfo->tickAndRenderOutput<LFOOutput10Bit>(buffer, BlockSize, dither);
+        Benchmark::keep(buffer);
+    }) / BlockSize;
+}
+
+/**
+ * @brief Error statistics of a quantized 10 bit output against the exact 24 bit value
+ * 
+ *  The low frequency error is the error averaged over 64 samples, which is 
+ *  what remains after a simple RC filter on a PWM output.
+ */
+template <class QUANTIZE>
+static void reportError(const char *name, QUANTIZE quantize)
+{
+    DeluxeSoftwareLFO<1> lfo;
+    lfo.setWaveform(LFOWaveform::Sine);
+    lfo.setPhaseIncrement(12345);
+    const unsigned long samples = 1UL << 20;
+    const unsigned int window = 64;
+    double sum = 0, squares = 0, lowSquares = 0, windowSum = 0;
+    unsigned long windows = 0;
+    for (unsigned long s = 0; s < samples; s++)
+    {
+        uint32_t value = lfo.getValue();
+        lfo.tick();
+        double error = (quantize(value) * 16384.0 - value) / 16384.0;  //In output steps
+        sum += error;
+        squares += error * error;
+        windowSum += error;
+        if ((s % window) == window - 1)
+        {
+            lowSquares += (windowSum / window) * (windowSum / window);
+            windowSum = 0;
+            windows++;
+        }
+    }
+    printf("  %-30s mean %+7.3f  rms %6.3f  low frequency rms %6.3f (output steps)\n", 
+           name, sum / samples, sqrt(squares / samples), sqrt(lowSquares / windows));
+}
+
+void runOutputBenchmarks()
+{
+    Benchmark::section("DAC/PWM output formats (10 bit, 256 sample blocks, per sample)");
+
+    DeluxeSoftwareLFO<1> deluxe;
+    deluxe.setFrequency(3.7f);
+    deluxe.setWaveform(LFOWaveform::Triangle);
+    BasicDeluxeLFO<EightBitWaveforms> *lfo = Benchmark::opaque(static_cast<BasicDeluxeLFO<EightBitWaveforms> *>(&deluxe));
+
+    uint32_t values[BlockSize];
+    uint16_t shifted[BlockSize];
+    double ns = Benchmark::nsPerOp(Benchmark::DefaultIterations / BlockSize, [&]{
+        lfo->tickAndRender(values, BlockSize);
+        for (size_t s = 0; s < BlockSize; s++) shifted[s] = static_cast<uint16_t>(values[s] >> 14);
+        Benchmark::keep(shifted);
+    }) / BlockSize;
+    Benchmark::report("tickAndRender() then >> 14", ns);
+
+    LFONoDither none;
+    LFOTPDFDither tpdf;
+    LFONoiseShapedDither shaped;
+    Benchmark::report("tickAndRenderOutput() rounded", timeRenderOutput(lfo, none));
+    Benchmark::report("tickAndRenderOutput() TPDF dither", timeRenderOutput(lfo, tpdf));
+    Benchmark::report("tickAndRenderOutput() noise shaped", timeRenderOutput(lfo, shaped));
+
+    //The block and single value paths must agree
+    DeluxeSoftwareLFO<1> a, b;
+    a.setFrequency(3.7f);
+    b.setFrequency(3.7f);
+    int16_t block[BlockSize];
+    unsigned long mismatches = 0;
+    for (int i = 0; i < 1000; i++)
+    {
+        a.renderOutput<LFOOutputSigned16Bit>(block, BlockSize);
+        for (size_t s = 0; s < BlockSize; s++)
+        {
+            if (block[s] != b.getOutput<LFOOutputSigned16Bit>()) mismatches++;
+            b.tick();
+        }
+    }
+    printf("  renderOutput() mismatches vs getOutput(): %lu\n", mismatches);
+
+    Benchmark::section("10 bit quantization error (sine, 2^20 samples)");
+    reportError("truncation (>> 14)", [](uint32_t v){ return v >> 14; });
+    reportError("LFONoDither (rounded)", [&](uint32_t v){ return none.quantize<LFOOutput10Bit>(v); });
+    reportError("LFOTPDFDither", [&](uint32_t v){ return tpdf.quantize<LFOOutput10Bit>(v); });
+    reportError("LFONoiseShapedDither", [&](uint32_t v){ return shaped.quantize<LFOOutput10Bit>(v); });
+}
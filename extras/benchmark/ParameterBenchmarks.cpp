@@ -0,0 +1,161 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file ParameterBenchmarks.cpp 
+//!  @brief Benchmarks and concurrent writer stress test for AtomicLFO
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#include "Benchmark.h"
+#include "SoftwareLFO.h"
+#include "AtomicLFO.h"
+#include <thread>
+#include <atomic>
+#include <vector>
+
+static constexpr unsigned int NumWriters = 2;
+
+/**
+ * @brief AtomicLFO exposing the applied waveform table for checking
+ */
+class ProbeLFO: public AtomicLFO<DeluxeSoftwareLFO<1>>
+{
+    public:
+        EightBitWaveforms::Table getWavetable() const { return wavetable; }
+};
+
+/**
+ * @brief Parameters written by the stress test: both increment halves and the waveform derive from one number
+ */
+static uint32_t testIncrement(uint32_t x) { return (x << 16) | x; }
+static LFOWaveform testWaveform(uint32_t x) { return static_cast<LFOWaveform>(x % static_cast<uint32_t>(LFOWaveform::N_WAVEFORMS)); }
+
+/**
+ * @brief Writers publish parameter sets while this thread ticks the LFO and checks every applied set
+ * 
+ * @param name The name printed in the report
+ * @param pause The pause between updates of each writer
+ */
+static void stressTest(const char *name, std::chrono::microseconds pause)
+{
+    ProbeLFO lfo;
+    std::atomic<bool> done(false);
+    std::atomic<unsigned long> published(0);
+    std::vector<std::thread> writers;
+    for (unsigned int w = 0; w < NumWriters; w++)
+    {
+        writers.emplace_back([&, w]{
+            unsigned long count = 0;
+            for (uint32_t x = w + 1; !done.load(std::memory_order_relaxed); x = (x + NumWriters) & 0xFFFF)
+            {
+                lfo.setParameters(testIncrement(x), testWaveform(x));
+                count++;
+                if (pause.count() > 0) std::this_thread::sleep_for(pause);
+            }
+            published += count;
+        });
+    }
+
+    unsigned long ticks = 0, changes = 0, torn = 0;
+    uint32_t previous = 0;
+    auto begin = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - begin < std::chrono::milliseconds(500))
+    {
+        for (int i = 0; i < 1000; i++)
+        {
+            lfo.tick();
+            uint32_t increment = lfo.getPhaseIncrement();
+            uint32_t x = increment & 0xFFFF;
+            if (increment == previous) continue;
+            previous = increment;
+            changes++;
+            if (((increment >> 16) != x) || (lfo.getWavetable() != EightBitWaveforms::getTable(testWaveform(x)))) torn++;
+        }
+        ticks += 1000;
+    }
+    done.store(true);
+    for (std::thread &writer : writers) writer.join();
+    printf("  stress %-24s %u writers, %9lu updates published, %9lu ticks, %8lu applied, %lu torn\n",
+           name, NumWriters, published.load(), ticks, changes, torn);
+}
+
+void runParameterBenchmarks()
+{
+    const unsigned long n = Benchmark::DefaultIterations;
+    Benchmark::section("AtomicLFO parameter updates");
+
+    DeluxeSoftwareLFO<1> plain;
+    plain.setFrequency(3.7f);
+    DeluxeSoftwareLFO<1> *plainLFO = Benchmark::opaque(&plain);
+    Benchmark::report("tick() DeluxeSoftwareLFO", Benchmark::nsPerOp(n, [&]{
+        plainLFO->tick();
+        Benchmark::keep(*plainLFO);
+    }));
+
+    ProbeLFO probe;
+    probe.setFrequency(3.7f);
+    ProbeLFO *atomicLFO = Benchmark::opaque(&probe);
+    Benchmark::report("tick() AtomicLFO", Benchmark::nsPerOp(n, [&]{
+        atomicLFO->tick();
+        Benchmark::keep(*atomicLFO);
+    }));
+
+    float freq = 0.1f;
+    Benchmark::report("setFrequency() AtomicLFO", Benchmark::nsPerOp(n, [&]{
+        atomicLFO->setFrequency(freq);
+        freq += 0.001f;
+        Benchmark::keep(*atomicLFO);
+    }));
+
+    stressTest("full speed", std::chrono::microseconds(0));
+    stressTest("paced (sleep 1 us)", std::chrono::microseconds(1));
+}
@@ -0,0 +1,169 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file PrecisionBenchmarks.cpp 
+//!  @brief Benchmarks for the extended precision (64 bit) phase accumulator
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include "Benchmark.h"
+#include "SoftwareLFO.h"
+#include "ClockedLFO.h"
+#include "ExtendedPrecisionLFO.h"
+#include <math.h>
+
+typedef SoftwareLFO<1> PlainLFO;
+typedef ExtendedPrecisionLFO<SoftwareLFO<1>> PreciseLFO;
+
+/**
+ * @brief Compare the period error of a long period at 1 ms ticks with the 24 bit, 32 bit and 64 bit increments
+ */
+static void reportPeriod(const char *name, uint32_t periodMs)
+{
+    PlainLFO plain;
+    PreciseLFO precise;
+    plain.setPeriodMs(periodMs);
+    precise.setPeriodMs(periodMs);
+
+    //Period in ticks (ms) that each increment actually produces
+    //(the 24 bit increment is at least 1, like LFOCalculator's)
+    double counter = ldexp(1.0, LFOCounter::CounterBitDepth) / fmax(1.0, floor(ldexp(1.0, LFOCounter::CounterBitDepth) / periodMs));
+    double phase = ldexp(1.0, LFOCounter::PhaseBitDepth) / plain.getPhaseIncrement();
+    double extended = ldexp(1.0, 64) / static_cast<double>(precise.getPhaseIncrement64());
+
+    //Run the 64 bit LFO for one whole period and see how far from 0 the phase ends up
+    precise.advance(periodMs);
+    int64_t residue = static_cast<int64_t>(precise.getPhase64());
+
+    printf("  %-14s 24 bit %+11.4f%%  32 bit %+9.4f%%  64 bit %+.2e%%  phase after one period %+.2e turns\n", name,
+           (counter - periodMs) / periodMs * 100.0, (phase - periodMs) / periodMs * 100.0, 
+           (extended - periodMs) / periodMs * 100.0, static_cast<double>(residue) / ldexp(1.0, 64));
+}
+
+void runPrecisionBenchmarks()
+{
+    const unsigned long n = Benchmark::DefaultIterations;
+
+    Benchmark::section("Extended precision (64 bit) phase accumulator");
+
+    PlainLFO plain;
+    PreciseLFO precise;
+    plain.setPeriodMs(3UL * 60 * 60 * 1000);
+    precise.setPeriodMs(3UL * 60 * 60 * 1000);
+    PlainLFO *plainLFO = Benchmark::opaque(&plain);
+    PreciseLFO *preciseLFO = Benchmark::opaque(&precise);
+
+    Benchmark::report("SoftwareLFO::tick()", Benchmark::nsPerOp(n, [&]{
+        plainLFO->tick();
+        Benchmark::keep(plainLFO->getPhase());
+    }));
+    Benchmark::report("ExtendedPrecisionLFO::tick()", Benchmark::nsPerOp(n, [&]{
+        preciseLFO->tick();
+        Benchmark::keep(preciseLFO->getPhase());
+    }));
+    Benchmark::report("SoftwareLFO::advance(1000)", Benchmark::nsPerOp(n, [&]{
+        plainLFO->advance(1000);
+        Benchmark::keep(plainLFO->getPhase());
+    }));
+    Benchmark::report("ExtendedPrecisionLFO::advance(1000)", Benchmark::nsPerOp(n, [&]{
+        preciseLFO->advance(1000);
+        Benchmark::keep(preciseLFO->getPhase());
+    }));
+
+    uint32_t block[256];
+    Benchmark::report("SoftwareLFO::tickAndRender() per sample", Benchmark::nsPerOp(n / 256, [&]{
+        plainLFO->tickAndRender(block, 256);
+        Benchmark::keep(block[255]);
+    }) / 256);
+    Benchmark::report("ExtendedPrecisionLFO::tickAndRender() per sample", Benchmark::nsPerOp(n / 256, [&]{
+        preciseLFO->tickAndRender(block, 256);
+        Benchmark::keep(block[255]);
+    }) / 256);
+
+    uint32_t periodMs = 3600000UL;
+    Benchmark::report("SoftwareLFO::setPeriodMs()", Benchmark::nsPerOp(n / 10, [&]{
+        plainLFO->setPeriodMs(periodMs);
+        periodMs += 7;
+        Benchmark::keep(*plainLFO);
+    }));
+    Benchmark::report("ExtendedPrecisionLFO::setPeriodMs()", Benchmark::nsPerOp(n / 10, [&]{
+        preciseLFO->setPeriodMs(periodMs);
+        periodMs += 7;
+        Benchmark::keep(*preciseLFO);
+    }));
+
+    Benchmark::section("Period error of long periods at 1 ms ticks");
+    reportPeriod("1 hour", 3600000UL);
+    reportPeriod("3 hours", 3UL * 3600000UL);
+    reportPeriod("12 hours", 12UL * 3600000UL);
+    reportPeriod("24 hours", 24UL * 3600000UL);
+    reportPeriod("7 days", 7UL * 24 * 3600000UL);
+
+    //advance() and update() must match repeated tick() calls
+    PreciseLFO ticked, advanced;
+    ClockedLFO<PreciseLFO> updated;
+    ticked.setFrequencyMilliHz(1);
+    advanced.setFrequencyMilliHz(1);
+    updated.setFrequencyMilliHz(1);
+    unsigned long mismatches = 0;
+    uint32_t now = 0;
+    for (uint32_t step = 1; step < 5000; step += 37)
+    {
+        for (uint32_t i = 0; i < step; i++) ticked.tick();
+        advanced.advance(step);
+        now += step;
+        updated.update(now);
+        if ((ticked.getPhase64() != advanced.getPhase64()) || (ticked.getPhase64() != updated.getPhase64())) mismatches++;
+    }
+    printf("  advance()/update() mismatches vs tick(): %lu\n", mismatches);
+}
@@ -0,0 +1,164 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file RenderBenchmarks.cpp 
+//!  @brief Benchmarks comparing per-sample and block rendering
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include "Benchmark.h"
+#include "SoftwareLFO.h"
+
+static constexpr size_t BlockSize = 256;
+
+void runRenderBenchmarks()
+{
+    const unsigned long blocks = Benchmark::DefaultIterations / BlockSize;
+    uint32_t buffer[BlockSize];
+
+    Benchmark::section("Per-sample vs block rendering (256 sample blocks, per sample)");
+
+    DeluxeSoftwareLFO<1> deluxe;
+    deluxe.setFrequency(3.7f);
+    deluxe.setWaveform(LFOWaveform::Triangle);
+    BaseLFO *lfo = Benchmark::opaque(static_cast<BaseLFO *>(&deluxe));
+
+    double perSample = Benchmark::nsPerOp(blocks, [&]{
+        for (size_t s = 0; s < BlockSize; s++)
+        {
+            lfo->tick();
+            buffer[s] = lfo->getValue();
+        }
+        Benchmark::keep(buffer);
+    }) / BlockSize;
+    Benchmark::report("tick() + getValue() per sample", perSample);
+
+    double block = Benchmark::nsPerOp(blocks, [&]{
+        lfo->tickAndRender(buffer, BlockSize);
+        Benchmark::keep(buffer);
+    }) / BlockSize;
+    Benchmark::report("tickAndRender()", block);
+
+    block = Benchmark::nsPerOp(blocks, [&]{
+        lfo->render(buffer, BlockSize);
+        Benchmark::keep(buffer);
+    }) / BlockSize;
+    Benchmark::report("render()", block);
+
+    StaticLFO<1, LFOWaveform::Triangle> fixed;
+    fixed.setFrequency(3.7f);
+    StaticLFO<1, LFOWaveform::Triangle> *staticLFO = Benchmark::opaque(&fixed);
+    block = Benchmark::nsPerOp(blocks, [&]{
+        staticLFO->tickAndRender(buffer, BlockSize);
+        Benchmark::keep(buffer);
+    }) / BlockSize;
+    Benchmark::report("StaticLFO tickAndRender()", block);
+
+    Benchmark::section("Depth and offset scaling (256 sample blocks, per sample)");
+
+    DeluxeSoftwareLFO<1> scaled;
+    scaled.setFrequency(3.7f);
+    scaled.setWaveform(LFOWaveform::Triangle);
+    scaled.setPolarity(LFOPolarity::Bipolar);
+    scaled.setOffset(LFOScaling::Center);
+    scaled.setDepth(LFOScaling::FullDepth / 3);
+    lfo = Benchmark::opaque(static_cast<BaseLFO *>(&scaled));
+
+    block = Benchmark::nsPerOp(blocks, [&]{
+        lfo->render(buffer, BlockSize);
+        Benchmark::keep(buffer);
+    }) / BlockSize;
+    Benchmark::report("render() with depth and offset", block);
+
+    block = Benchmark::nsPerOp(blocks, [&]{
+        for (size_t s = 0; s < BlockSize; s++)
+        {
+            buffer[s] = lfo->getValue();
+            lfo->tick();
+        }
+        Benchmark::keep(buffer);
+    }) / BlockSize;
+    Benchmark::report("getValue() + tick() with depth and offset", block);
+
+    //Compare LFOScaling::scale() against a 64 bit multiply and divide for every 24 bit value
+    const uint32_t depths[] = { 0, 1, 255, 256, 12345, LFOScaling::FullDepth / 3, LFOScaling::FullDepth - 1, LFOScaling::FullDepth };
+    unsigned long errors = 0;
+    for (uint32_t depth : depths)
+    {
+        for (uint32_t v = 0; v < LFOScaling::FullScale; v++)
+        {
+            uint32_t exact = static_cast<uint32_t>((static_cast<uint64_t>(v) * depth) / LFOScaling::FullDepth);
+            if (LFOScaling::scale(v, depth) != exact) errors++;
+        }
+    }
+    printf("  LFOScaling::scale() mismatches vs 64 bit divide: %lu of %lu\n", errors, 
+           static_cast<unsigned long>(sizeof(depths) / sizeof(depths[0]) * LFOScaling::FullScale));
+
+    //The bipolar output stays centred and within range
+    uint32_t low = 0xFFFFFFFF, high = 0;
+    scaled.reset();
+    scaled.setPhaseIncrement(1UL << 12);
+    for (unsigned long s = 0; s < (1UL << 20); s += BlockSize)
+    {
+        scaled.render(buffer, BlockSize);
+        for (size_t i = 0; i < BlockSize; i++)
+        {
+            if (buffer[i] < low) low = buffer[i];
+            if (buffer[i] > high) high = buffer[i];
+        }
+    }
+    printf("  bipolar depth 1/3 around centre: min %lu max %lu (expected about %lu to %lu)\n", 
+           static_cast<unsigned long>(low), static_cast<unsigned long>(high),
+           static_cast<unsigned long>(LFOScaling::Center - LFOScaling::FullScale / 6), 
+           static_cast<unsigned long>(LFOScaling::Center + LFOScaling::FullScale / 6));
+}
@@ -0,0 +1,125 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file RenderEngineBenchmarks.cpp 
+//!  @brief Thread scaling benchmark for LFORenderEngine
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#include "Benchmark.h"
+#include "SoftwareLFO.h"
+#include "LFORenderEngine.h"
+#include <algorithm>
+#include <list>
+#include <vector>
+
+static constexpr size_t NumLFOs = 4096;
+static constexpr size_t SamplesPerLFO = 4096;
+
+void runRenderEngineBenchmarks()
+{
+    Benchmark::section("LFORenderEngine (4096 LFO's x 4096 samples)");
+
+    //A mix of configurations with different per-sample costs
+    std::list<DeluxeSoftwareLFO<1>> linear;
+    std::list<DeluxeSoftwareLFO<1, SixteenBitWaveforms, HermiteInterpolation>> hermite;
+    std::vector<BaseLFO *> lfos;
+    for (size_t i = 0; i < NumLFOs; i++)
+    {
+        LFOWaveform waveform = static_cast<LFOWaveform>(i % 7);
+        if (i % 4 == 3)
+        {
+            hermite.emplace_back();
+            hermite.back().setFrequency(0.1f + i * 0.01f);
+            hermite.back().setWaveform(waveform);
+            lfos.push_back(&hermite.back());
+        }
+        else
+        {
+            linear.emplace_back();
+            linear.back().setFrequency(0.1f + i * 0.01f);
+            linear.back().setWaveform(waveform);
+            lfos.push_back(&linear.back());
+        }
+    }
+
+    LFORenderBuffers buffers(NumLFOs, SamplesPerLFO);
+    const double samples = static_cast<double>(NumLFOs) * SamplesPerLFO;
+    double single = 0;
+    unsigned int cores = std::thread::hardware_concurrency();
+    if (cores == 0) cores = 1;
+    for (unsigned int threads = 1; threads <= std::max(cores, 4u); threads *= 2)
+    {
+        LFORenderEngine engine(threads);
+        engine.render(lfos.data(), lfos.size(), buffers); //Warm up
+        auto begin = std::chrono::steady_clock::now();
+        const int repeats = 4;
+        for (int r = 0; r < repeats; r++) engine.render(lfos.data(), lfos.size(), buffers);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count() / repeats;
+        if (threads == 1) single = seconds;
+        printf("  %2u threads: %8.1f ms per render  %7.1f M samples/s  speedup %5.2fx\n",
+               threads, seconds * 1000, samples / seconds / 1e6, single / seconds);
+    }
+    printf("  (%u hardware threads available)\n", cores);
+
+    //Check the engine output against rendering each LFO directly
+    std::vector<uint32_t> expected(SamplesPerLFO);
+    unsigned long mismatches = 0;
+    for (size_t i = 0; i < NumLFOs; i += 97)
+    {
+        uint32_t phase = lfos[i]->getPhase();
+        lfos[i]->setPhase(phase - lfos[i]->getPhaseIncrement() * SamplesPerLFO);
+        lfos[i]->render(expected.data(), SamplesPerLFO);
+        for (size_t s = 0; s < SamplesPerLFO; s++) if (expected[s] != buffers[i][s]) mismatches++;
+    }
+    printf("  mismatches vs single threaded render(): %lu\n", mismatches);
+}
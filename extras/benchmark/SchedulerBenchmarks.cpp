@@ -0,0 +1,169 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file SchedulerBenchmarks.cpp 
+//!  @brief Benchmarks and concurrent reader stress test for LFOScheduler
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#include "Benchmark.h"
+#include "SoftwareLFO.h"
+#include "LFOScheduler.h"
+#include <thread>
+#include <atomic>
+#include <vector>
+
+static constexpr size_t NumLFOs = 4;
+static constexpr unsigned int NumReaders = 3;
+
+/**
+ * @brief Multiplicative inverse of an odd number modulo 2^32
+ */
+static uint32_t inverse(uint32_t odd)
+{
+    uint32_t x = odd;
+    for (int i = 0; i < 5; i++) x *= 2 - odd * x;
+    return x;
+}
+
+/**
+ * @brief Results of one reader thread
+ */
+struct ReaderResult
+{
+    unsigned long reads = 0;
+    unsigned long retries = 0;
+    unsigned long inconsistent = 0;
+};
+
+void runSchedulerBenchmarks()
+{
+    Benchmark::section("LFOScheduler");
+
+    //Odd increments, so the tick count can be recovered from any phase
+    const uint32_t increments[NumLFOs] = { 0x00012345UL, 0x0ABCDEF1UL, 0x00000FFFUL, 0x7FFFFFFFUL };
+    DeluxeSoftwareLFO<1> lfos[NumLFOs];
+    LFOScheduler<NumLFOs> scheduler;
+    for (size_t i = 0; i < NumLFOs; i++)
+    {
+        lfos[i].setPhaseIncrement(increments[i]);
+        lfos[i].setWaveform(static_cast<LFOWaveform>(i));
+        scheduler.add(&lfos[i]);
+    }
+
+    LFOScheduler<NumLFOs> *typed = Benchmark::opaque(&scheduler);
+    Benchmark::report("tick() 4 LFO's", Benchmark::nsPerOp(Benchmark::DefaultIterations / 10, [&]{
+        typed->tick();
+    }));
+    Benchmark::report("read()", Benchmark::nsPerOp(Benchmark::DefaultIterations, [&]{
+        Benchmark::keep(typed->read(1));
+    }));
+
+    //Stress test: tick as fast as possible while readers check every snapshot
+    uint32_t start[NumLFOs];
+    for (size_t i = 0; i < NumLFOs; i++) start[i] = scheduler.read(i).phase;
+    std::atomic<bool> done(false);
+    std::vector<ReaderResult> results(NumReaders);
+    std::vector<std::thread> readers;
+    for (unsigned int r = 0; r < NumReaders; r++)
+    {
+        readers.emplace_back([&, r]{
+            ReaderResult &result = results[r];
+            DeluxeSoftwareLFO<1> reference[NumLFOs];
+            uint32_t lastTicks[NumLFOs] = {};
+            for (size_t i = 0; i < NumLFOs; i++) reference[i].setWaveform(static_cast<LFOWaveform>(i));
+            size_t i = r;
+            while (!done.load(std::memory_order_relaxed))
+            {
+                i = (i + 1) % NumLFOs;
+                LFOSnapshot snapshot;
+                while (!scheduler.tryRead(i, snapshot)) result.retries++;
+                result.reads++;
+                //A torn snapshot has a value that does not match its phase, or a phase that went backwards
+                reference[i].setPhase(snapshot.phase);
+                uint32_t ticks = (snapshot.phase - start[i]) * inverse(increments[i]);
+                if ((reference[i].getValue() != snapshot.value) || (ticks < lastTicks[i])) result.inconsistent++;
+                lastTicks[i] = ticks;
+            }
+        });
+    }
+
+    LFOSchedulerThread<LFOScheduler<NumLFOs>> timer(scheduler);
+    auto begin = std::chrono::steady_clock::now();
+    timer.start(std::chrono::microseconds(0));
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    timer.stop();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    done.store(true);
+    for (std::thread &reader : readers) reader.join();
+
+    ReaderResult total;
+    for (const ReaderResult &result : results)
+    {
+        total.reads += result.reads;
+        total.retries += result.retries;
+        total.inconsistent += result.inconsistent;
+    }
+    uint32_t ticks = (scheduler.read(0).phase - start[0]) * inverse(increments[0]);
+    printf("  stress: %u readers, %.1f M ticks/s, %lu reads, %lu retries, %lu inconsistent snapshots\n",
+           NumReaders, ticks / seconds / 1e6, total.reads, total.retries, total.inconsistent);
+
+    //Timer accuracy at a 1 kHz tick rate
+    uint32_t before = scheduler.read(0).phase;
+    begin = std::chrono::steady_clock::now();
+    timer.start(std::chrono::microseconds(1000));
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    timer.stop();
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    ticks = (scheduler.read(0).phase - before) * inverse(increments[0]);
+    printf("  1 kHz timer: %lu ticks in %.0f ms\n", static_cast<unsigned long>(ticks), seconds * 1000);
+}
@@ -0,0 +1,95 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file StreamBenchmarks.cpp 
+//!  @brief Benchmarks and DMA simulation for LFOStreamBuffer
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#include "Benchmark.h"
+#include "StreamSimulation.h"
+
+using namespace StreamSimulation;
+
+static void reportSimulation(const char *name, const Result &result)
+{
+    printf("  %s: %lu halves, %lu underruns counted, %lu halves replayed, %lu dropped, %lu wrong, fill() busy %.3f%% (headroom %.1f%%)\n",
+           name, result.halves, static_cast<unsigned long>(result.underruns), result.replayed,
+           static_cast<unsigned long>(result.dropped), result.wrong,
+           100.0 * result.fillSeconds / result.seconds, 100.0 * (1.0 - result.fillSeconds / result.seconds));
+}
+
+void runStreamBenchmarks()
+{
+    Benchmark::section("LFOStreamBuffer (2 channels, 12 bit, 256 frame halves)");
+
+    StreamLFO lfos[Channels];
+    setupLFOs(lfos);
+    Stream stream;
+    for (size_t c = 0; c < Channels; c++) stream.attach(c, lfos[c]);
+    Stream *typed = Benchmark::opaque(&stream);
+    double ns = Benchmark::nsPerOp(Benchmark::DefaultIterations / HalfFrames, [&]{
+        typed->onHalfComplete();
+        typed->fill();
+    });
+    Benchmark::report("fill() one half", ns);
+    printf("  %.2f%% of one core at %lu Hz\n", 100.0 * ns / (1e9 * HalfFrames / SampleRate), SampleRate);
+
+    Result result = simulate(2.0, 0);
+    reportSimulation("simulated DMA at 48 kHz, 2 s", result);
+    Benchmark::check((result.underruns == 0) && (result.replayed == 0) && (result.wrong == 0), "no underruns or wrong halves without stalls");
+
+    //The stalls are longer than one half period (5.3 ms), so the DMA catches up with the writer
+    result = simulate(1.0, 12);
+    reportSimulation("same, with 12 ms stalls in loop()", result);
+    Benchmark::check((result.wrong == 0) && (result.skipped <= result.dropped), "only dropped halves skipped with stalls");
+}
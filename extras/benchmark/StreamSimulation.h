@@ -0,0 +1,218 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file StreamSimulation.h 
+//!  @brief Real time simulation of a circular DMA channel reading an LFOStreamBuffer
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#ifndef _SOFTWARE_LFO_STREAM_SIMULATION_H_
+#define _SOFTWARE_LFO_STREAM_SIMULATION_H_
+
+#include "SoftwareLFO.h"
+#include "LFOStreamBuffer.h"
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+
+namespace StreamSimulation
+{
+    static constexpr unsigned long SampleRate = 48000;
+    static constexpr size_t HalfFrames = 256;
+    static constexpr size_t Channels = 2;
+
+    typedef DeluxeSoftwareLFOHz<SampleRate> StreamLFO;
+    typedef LFOStreamBuffer<StreamLFO, LFOOutput12Bit, HalfFrames, Channels> Stream;
+
+    inline void setupLFOs(StreamLFO *lfos)
+    {
+        lfos[0].setFrequency(2.0f);
+        lfos[0].setWaveform(LFOWaveform::Sine);
+        lfos[1].setFrequency(0.7f);
+        lfos[1].setWaveform(LFOWaveform::Triangle);
+    }
+
+    /**
+     * @brief Results of one simulated stream
+     */
+    struct Result
+    {
+        unsigned long halves = 0;       //!< Halves read by the simulated DMA
+        unsigned long replayed = 0;     //!< Halves read again because they were not filled in time
+        unsigned long wrong = 0;        //!< Newly filled halves which did not continue the expected samples
+        unsigned long skipped = 0;      //!< Blocks skipped to resync the expected samples (each one reported as dropped)
+        uint32_t underruns = 0;         //!< Underruns counted by the stream
+        uint32_t dropped = 0;           //!< Dropped blocks counted by the stream
+        double fillSeconds = 0;         //!< Time spent in fill()
+        double seconds = 0;             //!< Length of the simulation
+    };
+
+    /**
+     * @brief Check if a newly read half continues the reference LFO's, skipping at most maxSkip dropped blocks
+     * 
+     * @param reference The reference LFO's, advanced past the matching block
+     * @param half The samples read by the DMA
+     * @param maxSkip The number of dropped blocks not matched yet
+     * @return int The number of blocks skipped, or -1 if no block matched (the reference then advances one block)
+     */
+    inline int match(StreamLFO *reference, const uint16_t *half, uint32_t maxSkip)
+    {
+        uint16_t expected[HalfFrames];
+        for (uint32_t skip = 0; skip <= maxSkip; skip++)
+        {
+            StreamLFO candidate[Channels];
+            std::copy(reference, reference + Channels, candidate);
+            bool correct = true;
+            for (size_t c = 0; c < Channels; c++)
+            {
+                for (uint32_t s = 0; s < skip; s++) candidate[c].renderOutput<LFOOutput12Bit>(expected, HalfFrames);
+                candidate[c].renderOutput<LFOOutput12Bit>(expected, HalfFrames);
+                for (size_t f = 0; f < HalfFrames; f++) if (half[f * Channels + c] != expected[f]) correct = false;
+            }
+            if (correct)
+            {
+                std::copy(candidate, candidate + Channels, reference);
+                return static_cast<int>(skip);
+            }
+        }
+        for (size_t c = 0; c < Channels; c++) reference[c].renderOutput<LFOOutput12Bit>(expected, HalfFrames);
+        return -1;
+    }
+
+    /**
+     * @brief Stream for a while, with a thread reading the buffer in real time like a circular DMA channel
+     * 
+     * Every newly filled half must continue the samples of the previous one.  
+     * Blocks are only skipped when the stream reported them as dropped.
+     * 
+     * @param seconds The length of the simulation
+     * @param stallMs How long loop() stalls every 50 ms (0 for no stalls)
+     */
+    inline Result simulate(double seconds, unsigned int stallMs)
+    {
+        StreamLFO lfos[Channels];
+        StreamLFO reference[Channels];
+        setupLFOs(lfos);
+        setupLFOs(reference);
+        Stream stream;
+        for (size_t c = 0; c < Channels; c++) stream.attach(c, lfos[c]);
+        stream.prime();
+
+        Result result;
+        std::atomic<bool> done(false);
+        std::atomic<unsigned long> loops(0);
+        const auto halfPeriod = std::chrono::nanoseconds(1000000000ULL * HalfFrames / SampleRate);
+        const auto begin = std::chrono::steady_clock::now();
+
+        //The simulated DMA starts reading half k % 2 at the start of period k and interrupts at its end
+        std::thread dma([&]{
+            const unsigned long halves = static_cast<unsigned long>(seconds * SampleRate / HalfFrames);
+            uint16_t last[2][Stream::HalfSize] = {};
+            auto deadline = begin;
+            for (unsigned long k = 0; k < halves; k++)
+            {
+                const uint16_t *half = stream.getBuffer() + (k & 1) * Stream::HalfSize;
+                if ((k >= 2) && std::equal(half, half + Stream::HalfSize, last[k & 1]))
+                {
+                    result.replayed++;
+                }
+                else
+                {
+                    int skip = match(reference, half, stream.getDropped() - result.skipped);
+                    if (skip < 0) result.wrong++;
+                    else result.skipped += skip;
+                    std::copy(half, half + Stream::HalfSize, last[k & 1]);
+                }
+                result.halves++;
+                //A real DMA never runs late.  If this thread was descheduled, the timeline restarts from now and
+                //this half still lasts a whole period, rather than ending at once before fill() had a chance to run
+                deadline = std::max(deadline, std::chrono::steady_clock::now()) + halfPeriod;
+                std::this_thread::sleep_until(deadline);
+                //If it woke up late, loop() was probably descheduled as well, so the lost time is not counted
+                //against it: the half ends once loop() has run again
+                if (std::chrono::steady_clock::now() - deadline > halfPeriod / 4)
+                {
+                    const unsigned long seen = loops.load();
+                    while (loops.load() - seen < 2) std::this_thread::yield();
+                    deadline = std::chrono::steady_clock::now();
+                }
+                if (k & 1) stream.onComplete();
+                else stream.onHalfComplete();
+            }
+            done.store(true);
+        });
+
+        //loop()
+        auto nextStall = begin + std::chrono::milliseconds(50);
+        while (!done.load())
+        {
+            auto start = std::chrono::steady_clock::now();
+            stream.fill();
+            result.fillSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (stallMs && (start > nextStall))
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(stallMs));
+                nextStall = start + std::chrono::milliseconds(50);
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            loops++;
+        }
+        dma.join();
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        result.underruns = stream.getUnderruns();
+        result.dropped = stream.getDropped();
+        return result;
+    }
+}
+
+#endif
@@ -0,0 +1,163 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file SyncBenchmarks.cpp 
+//!  @brief Benchmarks for phase synchronization of several boards
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include "Benchmark.h"
+#include "SoftwareLFO.h"
+#include "SyncedLFO.h"
+#include <math.h>
+#include <stdlib.h>
+
+typedef SyncedLFO<SoftwareLFO<1>> BoardLFO;
+
+/**
+ * @brief Number of simulated boards
+ */
+static constexpr unsigned int Boards = 4;
+
+/**
+ * @brief Clock skew of each simulated board in ppm (positive ticks faster than the shared clock)
+ */
+static const double BoardSkewPpm[Boards] = { -200.0, 50.0, 300.0, 1000.0 };
+
+/**
+ * @brief Simulate boards with skewed clocks running a 0.5 Hz LFO for 10 minutes of shared time
+ * 
+ * Every board ticks from its own clock and receives the shared tick count once a second.
+ * 
+ * @param name The name of the run
+ * @param correct Whether the boards call syncToTime() (otherwise only setPhaseFromTime() at the start)
+ * @param jitterTicks The maximum error of each received tick count
+ * @param gainShift The setSyncGain() of the boards
+ */
+static void simulateBoards(const char *name, bool correct, uint32_t jitterTicks, uint8_t gainShift)
+{
+    const uint32_t syncInterval = 1000;
+    const uint32_t duration = 600000;
+    BoardLFO boards[Boards];
+    uint64_t localTicks[Boards];
+    for (unsigned int b = 0; b < Boards; b++)
+    {
+        boards[b].setFrequencyMilliHz(500);
+        boards[b].setSyncGain(gainShift);
+        boards[b].setPhaseFromTime(0);
+        localTicks[b] = 0;
+    }
+    srand(1);
+    const uint32_t nominal = boards[0].getNominalIncrement();
+    double worstLast = 0;
+    for (uint32_t shared = 1; shared <= duration; shared++)
+    {
+        for (unsigned int b = 0; b < Boards; b++)
+        {
+            //Run the board's own clock up to this shared time
+            uint64_t target = static_cast<uint64_t>(floor(shared * (1.0 + BoardSkewPpm[b] * 1e-6)));
+            boards[b].advance(static_cast<uint32_t>(target - localTicks[b]));
+            localTicks[b] = target;
+            if (correct && (shared % syncInterval == 0))
+            {
+                int32_t jitter = jitterTicks ? (rand() % (2 * jitterTicks + 1)) - static_cast<int32_t>(jitterTicks) : 0;
+                boards[b].syncToTime(shared + jitter);
+            }
+            //Worst phase error over the last minute, after the loops have settled
+            if (shared > duration - 60000)
+            {
+                int32_t error = static_cast<int32_t>(shared * nominal - boards[b].getPhase());
+                worstLast = fmax(worstLast, fabs(static_cast<double>(error)) / 4294967296.0 * 360.0);
+            }
+        }
+    }
+    printf("  %-40s worst phase error in the last minute: %9.4f degrees", name, worstLast);
+    if (correct)
+    {
+        printf("  (learned skew");
+        for (unsigned int b = 0; b < Boards; b++) printf(" %+.1f", -boards[b].getSkew() / 2147483648.0 * 1e6);
+        printf(" ppm)");
+    }
+    printf("\n");
+}
+
+void runSyncBenchmarks()
+{
+    const unsigned long n = Benchmark::DefaultIterations;
+
+    Benchmark::section("Phase synchronization to a shared time base");
+
+    BoardLFO board;
+    board.setFrequency(0.5f);
+    BoardLFO *lfo = Benchmark::opaque(&board);
+    uint64_t epoch = 123456789ULL;
+    Benchmark::report("setPhaseFromTime()", Benchmark::nsPerOp(n, [&]{
+        lfo->setPhaseFromTime(epoch);
+        epoch += 1000;
+        Benchmark::keep(lfo->getPhase());
+    }));
+    Benchmark::report("syncToTime()", Benchmark::nsPerOp(n, [&]{
+        lfo->advance(1000);
+        lfo->syncToTime(epoch);
+        epoch += 1000;
+        Benchmark::keep(lfo->getPhase());
+    }));
+
+    printf("  Boards at");
+    for (unsigned int b = 0; b < Boards; b++) printf(" %+.0f", BoardSkewPpm[b]);
+    printf(" ppm, 0.5 Hz, 1 ms ticks, sync once a second for 10 minutes\n");
+    simulateBoards("free running", false, 0, 7);
+    simulateBoards("syncToTime()", true, 0, 7);
+    simulateBoards("syncToTime(), +/-2 tick jitter", true, 2, 7);
+    simulateBoards("syncToTime(), +/-2 tick jitter, gain 9", true, 2, 9);
+}
@@ -0,0 +1,169 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file TableBenchmarks.cpp 
+//!  @brief Benchmarks and accuracy checks for the waveform table formats
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#include "Benchmark.h"
+#include "SoftwareLFO.h"
+#include <math.h>
+
+static constexpr size_t BlockSize = 256;
+
+/**
+ * @brief Time per-sample lookups and block rendering for one waveform table class
+ */
+template <class WAVEFORMS>
+static void benchmarkTables(const char *tableName)
+{
+    const unsigned long n = Benchmark::DefaultIterations;
+    char name[64];
+    uint32_t buffer[BlockSize];
+
+    DeluxeSoftwareLFO<1, WAVEFORMS> deluxe;
+    deluxe.setFrequency(3.7f);
+    deluxe.setWaveform(LFOWaveform::Triangle);
+    DeluxeSoftwareLFO<1, WAVEFORMS> *lfo = Benchmark::opaque(&deluxe);
+
+    //Pseudo-random phases so every lookup lands on a different table entry
+    uint32_t phase = 0x12345678;
+    typename WAVEFORMS::Table table = Benchmark::opaque(WAVEFORMS::getTable(LFOWaveform::Triangle));
+    snprintf(name, sizeof(name), "%s interpolate()", tableName);
+    Benchmark::report(name, Benchmark::nsPerOp(n, [&]{
+        phase = phase * 1664525UL + 1013904223UL;
+        Benchmark::keep(WAVEFORMS::interpolate(table, phase));
+    }));
+
+    snprintf(name, sizeof(name), "%s tickAndRender() per sample", tableName);
+    Benchmark::report(name, Benchmark::nsPerOp(n / BlockSize, [&]{
+        lfo->tickAndRender(buffer, BlockSize);
+        Benchmark::keep(buffer);
+    }) / BlockSize);
+}
+
+/**
+ * @brief Count the phases where two table classes produce different output
+ */
+template <class A, class B>
+static unsigned long countMismatches()
+{
+    unsigned long mismatches = 0;
+    for (unsigned int w = 0; w < static_cast<unsigned int>(LFOWaveform::N_WAVEFORMS); w++)
+    {
+        LFOWaveform waveform = static_cast<LFOWaveform>(w);
+        for (uint32_t phase = 0; phase < 0xFFFFF000UL; phase += 0xFFF)
+        {
+            if (A::interpolate(A::getTable(waveform), phase) != B::interpolate(B::getTable(waveform), phase)) mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+/**
+ * @brief Report the worst case error of a sine table against the ideal sine wave
+ * 
+ * @param tableName The name printed in the report
+ * @param sampleBits The table sample bit depth
+ * @param bytes The memory used by the sine table
+ */
+template <class WAVEFORMS>
+static void reportSineAccuracy(const char *tableName, unsigned int sampleBits, unsigned int bytes)
+{
+    //The tables hold round(2^(bits-1) + (2^(bits-1) - 1) * sin(x)), scaled to the 24 bit output
+    const double center = ldexp(1.0, sampleBits - 1);
+    const double scale = ldexp(1.0, 24 - sampleBits);
+    typename WAVEFORMS::Table table = WAVEFORMS::getTable(LFOWaveform::Sine);
+    double maxError = 0;
+    for (uint32_t phase = 0; phase < 0xFFFFF000UL; phase += 0x3FF)
+    {
+        double ideal = (center + (center - 1) * sin(2.0 * M_PI * phase / 4294967296.0)) * scale;
+        maxError = fmax(maxError, fabs(static_cast<double>(WAVEFORMS::interpolate(table, phase)) - ideal));
+    }
+    printf("  %-24s %6u bytes  max error %8.1f LSB (24 bit)  %5.1f effective bits\n",
+           tableName, bytes, maxError, 24 - log2(maxError));
+}
+
+void runTableBenchmarks()
+{
+    Benchmark::section("Waveform table formats");
+    benchmarkTables<EightBitWaveforms>("EightBit");
+    benchmarkTables<EightBitDeltaWaveforms>("EightBitDelta");
+    benchmarkTables<EightBitQuarterSine>("EightBitQuarterSine");
+    benchmarkTables<SixteenBitQuarterSine>("SixteenBitQuarterSine");
+    benchmarkTables<WaveformTables<8, 1024>>("WaveformTables<8, 1024>");
+    benchmarkTables<WaveformTables<16, 1024>>("WaveformTables<16, 1024>");
+    benchmarkTables<WaveformTables<16, 4096>>("WaveformTables<16, 4096>");
+    printf("  EightBitDelta mismatches vs EightBit: %lu\n", countMismatches<EightBitWaveforms, EightBitDeltaWaveforms>());
+    printf("  WaveformTables<8, 256> mismatches vs EightBit: %lu\n", countMismatches<EightBitWaveforms, WaveformTables<8, 256>>());
+
+    unsigned long mismatches = 0;
+    for (uint32_t phase = 0; phase < 0xFFFFF000UL; phase += 0xFFF)
+    {
+        if (EightBitWaveforms::interpolate(EightBitWaveforms::sine, phase) != 
+            EightBitQuarterSine::interpolate(EightBitQuarterSine::quarter, phase)) mismatches++;
+    }
+    printf("  EightBitQuarterSine mismatches vs EightBit sine: %lu\n", mismatches);
+
+    Benchmark::section("Sine table accuracy and memory");
+    reportSineAccuracy<EightBitWaveforms>("EightBitWaveforms", 8, sizeof(EightBitWaveforms::sine));
+    reportSineAccuracy<EightBitQuarterSine>("EightBitQuarterSine", 8, sizeof(EightBitQuarterSine::quarter));
+    reportSineAccuracy<SixteenBitQuarterSine>("SixteenBitQuarterSine", 16, sizeof(SixteenBitQuarterSine::quarter));
+    reportSineAccuracy<WaveformTables<8, 256>>("WaveformTables<8, 256>", 8, sizeof(WaveformTables<8, 256>::sine));
+    reportSineAccuracy<WaveformTables<8, 1024>>("WaveformTables<8, 1024>", 8, sizeof(WaveformTables<8, 1024>::sine));
+    reportSineAccuracy<WaveformTables<8, 4096>>("WaveformTables<8, 4096>", 8, sizeof(WaveformTables<8, 4096>::sine));
+    reportSineAccuracy<WaveformTables<16, 256>>("WaveformTables<16, 256>", 16, sizeof(WaveformTables<16, 256>::sine));
+    reportSineAccuracy<WaveformTables<16, 1024>>("WaveformTables<16, 1024>", 16, sizeof(WaveformTables<16, 1024>::sine));
+    reportSineAccuracy<WaveformTables<16, 4096>>("WaveformTables<16, 4096>", 16, sizeof(WaveformTables<16, 4096>::sine));
+}
@@ -0,0 +1,330 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file FrequencyTests.cpp 
+//!  @brief Accuracy tests of the integer frequency calculations
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#include "Test.h"
+#include "SoftwareLFO.h"
+#include "CachedLFO.h"
+#include "ClockedLFO.h"
+#include "ExtendedPrecisionLFO.h"
+#include <math.h>
+
+/**
+ * @brief The documented accuracy of getIncrementValueForOctave() (0.0015%)
+ */
+static constexpr double MaxOctaveError = 0.0015 / 100.0;
+
+/**
+ * @brief Check getIncrementValueForOctave() against exp2() over the whole MinFrequency to MaxFrequency range
+ * 
+ *  Each increment may be off by MaxOctaveError, plus one LSB for the truncation of small increments.
+ */
+template <class CALCULATOR>
+static void testOctaveAccuracy(const char *name)
+{
+    const double multiplier = ldexp(1.0, CALCULATOR::CounterBitDepth) * static_cast<double>(CALCULATOR::TickNumerator) /
+                              static_cast<double>(CALCULATOR::TickDenominator);
+    const int32_t one = 1L << CALCULATOR::OctaveBits;
+    const int32_t lowest = static_cast<int32_t>(floor(log2(CALCULATOR::MinFrequency) * one));
+    const int32_t highest = static_cast<int32_t>(ceil(log2(CALCULATOR::MaxFrequency) * one));
+    double maxRelative = 0;
+    unsigned long points = 0, outside = 0;
+    for (int32_t octaves = lowest; octaves <= highest; octaves += 7)
+    {
+        double exact = multiplier * exp2(static_cast<double>(octaves) / one);
+        if (exact < 1 || exact > CALCULATOR::MaxIncrementValue) continue;
+        double error = fabs(CALCULATOR::getIncrementValueForOctave(octaves) - exact);
+        if (error > exact * MaxOctaveError + 1) outside++;
+        if (exact >= 65536) maxRelative = fmax(maxRelative, error / exact);
+        points++;
+    }
+    printf("  %-28s %8lu points, max error %.5f%%, %lu outside the bound\n", name, points, maxRelative * 100.0, outside);
+    LFO_CHECK(points > 0);
+    LFO_CHECK(outside == 0);
+    LFO_CHECK(maxRelative < MaxOctaveError);
+}
+
+/**
+ * @brief LFOIncrementMath::longDivide() (used without a native 64 bit division) must match the 64 bit division
+ */
+static void testLongDivide()
+{
+    typedef LFOIncrementMath<LFOCounter::PhaseBitDepth> Math;
+    unsigned long mismatches = 0, points = 0;
+    uint64_t x = 0x0123456789ABCDEFULL;
+    for (int i = 0; i < 200000; i++)
+    {
+        //xorshift64, with divisors spread over every bit length
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        uint32_t divisor = static_cast<uint32_t>(x) >> (i % 32);
+        if (divisor == 0) divisor = 1;
+        uint64_t dividend = x >> (i % 61);
+        uint64_t expected = dividend / divisor;
+        if (expected > 0xFFFFFFFFULL) expected = 0xFFFFFFFFULL;
+        mismatches += Math::longDivide(dividend, divisor) != expected;
+        points++;
+    }
+    const uint64_t edges[][2] = {
+        { 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFUL }, { 0xFFFFFFFEFFFFFFFFULL, 0xFFFFFFFFUL }, { 0x00000000FFFFFFFFULL, 1 },
+        { 0x7FFFFFFF80000000ULL, 0x80000000UL }, { 0x0000800000000000ULL, 0x00008001UL }, { 4294967296000ULL, 3 }, { 0, 7 },
+    };
+    for (const uint64_t *edge : edges)
+    {
+        uint64_t expected = edge[0] / edge[1];
+        if (expected > 0xFFFFFFFFULL) expected = 0xFFFFFFFFULL;
+        mismatches += Math::longDivide(edge[0], static_cast<uint32_t>(edge[1])) != expected;
+        points++;
+    }
+    printf("  longDivide()                 %8lu points, %lu mismatches\n", points, mismatches);
+    LFO_CHECK(mismatches == 0);
+}
+
+/**
+ * @brief LFOIncrementMath::longMultiplyDivide() (used by ClockedLFO without native 64 bit arithmetic) must match 64 bit math
+ */
+static void testLongMultiplyDivide()
+{
+    typedef LFOIncrementMath<LFOCounter::PhaseBitDepth> Math;
+    unsigned long mismatches = 0, points = 0;
+    uint64_t x = 0x0FEDCBA987654321ULL;
+    for (int i = 0; i < 200000; i++)
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        uint32_t a = static_cast<uint32_t>(x >> 32) >> (i % 32);
+        uint32_t b = static_cast<uint32_t>(x) >> ((i / 32) % 32);
+        uint32_t divisor = static_cast<uint32_t>(x >> 16) >> (i % 29);
+        if (divisor == 0) divisor = 1;
+        uint64_t expected = (static_cast<uint64_t>(a) * b) / divisor;
+        if (expected > 0xFFFFFFFFULL) expected = 0xFFFFFFFFULL;
+        mismatches += Math::longMultiplyDivide(a, b, divisor) != expected;
+        mismatches += Math::multiplyDivide(a, b, divisor) != expected;
+        points++;
+    }
+    mismatches += Math::longMultiplyDivide(0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL) != 0xFFFFFFFFUL;
+    mismatches += Math::longMultiplyDivide(0xFFFFFFFFUL, 0xFFFFFFFFUL, 1) != 0xFFFFFFFFUL;
+    mismatches += Math::longMultiplyDivide(0x0001FFFFUL, 0x0001FFFFUL, 0x10000UL) != 0x3FFFCUL;
+    points += 3;
+    printf("  longMultiplyDivide()         %8lu points, %lu mismatches\n", points, mismatches);
+    LFO_CHECK(mismatches == 0);
+}
+
+/**
+ * @brief ClockedLFO::update() must advance by exactly the ticks elapsed on the clock, across tick rate changes
+ */
+static void testClockedLFO()
+{
+    ClockedLFO<SoftwareLFOHz<44100>> audio;
+    audio.setPhaseIncrement(0x00012345UL);
+    uint32_t now = 0;
+    bool exact = true;
+    for (uint32_t step = 1; step < 2000; step += 13)
+    {
+        now += step;
+        audio.update(now);
+        exact &= audio.getPhase() == static_cast<uint32_t>(static_cast<uint64_t>(now) * 441 / 10 * 0x00012345UL);
+    }
+    LFO_CHECK(exact);
+
+    ClockedLFO<RuntimeSoftwareLFO<>> runtime;
+    runtime.setPhaseIncrement(0x01000000UL);
+    runtime.update(5);
+    LFO_CHECK(runtime.getPhase() == 5 * 0x01000000UL);
+    //Half as many ticks after the change, each twice as large
+    runtime.setTickRateMs(2);
+    LFO_CHECK(runtime.getPhaseIncrement() == 0x02000000UL);
+    runtime.update(9);
+    LFO_CHECK(runtime.getPhase() == 5 * 0x01000000UL + 2 * 0x02000000UL);
+
+    LFO_CHECK(sizeof(SoftwareLFO<1>) < sizeof(ClockedLFO<SoftwareLFO<1>>));
+}
+
+/**
+ * @brief Check that RuntimeLFOCalculator gives the same increments as the compile time calculator
+ */
+template <class CALCULATOR>
+static void testRuntimeCalculator(const char *name)
+{
+    RuntimeLFOCalculator<CALCULATOR::CounterBitDepth> runtime(CALCULATOR::TickNumerator, CALCULATOR::TickDenominator);
+    unsigned long points = 0, mismatches = 0;
+    for (double mHz = 1; mHz <= CALCULATOR::MaxFrequencyMilliHz; mHz *= 1.01)
+    {
+        uint32_t freq = static_cast<uint32_t>(mHz);
+        mismatches += CALCULATOR::getIncrementValueForFrequencyMilliHz(freq) != runtime.getIncrementValueForFrequencyMilliHz(freq);
+        mismatches += CALCULATOR::getIncrementValueForFrequency(freq / 1000.f) != runtime.getIncrementValueForFrequency(freq / 1000.f);
+        mismatches += CALCULATOR::getIncrementValueForPeriodMs(freq) != runtime.getIncrementValueForPeriodMs(freq);
+        mismatches += CALCULATOR::getIncrementValueForPeriod(1000.f / freq) != runtime.getIncrementValueForPeriod(1000.f / freq);
+        points += 4;
+    }
+    for (int32_t octaves = -20 * 65536L; octaves <= 20 * 65536L; octaves += 997)
+    {
+        mismatches += CALCULATOR::getIncrementValueForOctave(octaves) != runtime.getIncrementValueForOctave(octaves);
+        points++;
+    }
+    printf("  %-28s %8lu points, %lu mismatches\n", name, points, mismatches);
+    LFO_CHECK(mismatches == 0);
+    LFO_CHECK(CALCULATOR::TicksPerMsNumerator == runtime.getTicksPerMsNumerator());
+    LFO_CHECK(CALCULATOR::TicksPerMsDenominator == runtime.getTicksPerMsDenominator());
+}
+
+/**
+ * @brief The output rendered by an ExtendedPrecisionLFO inside a CachedLFO must match a per-tick reference
+ * 
+ * @param tickFirst Test tickAndRenderOutput() instead of renderOutput()
+ */
+static void testExtendedPrecisionRender(bool tickFirst)
+{
+    typedef ExtendedPrecisionLFO<DeluxeSoftwareLFO<1>> PreciseLFO;
+    typedef LFOOutputSigned16Bit Format;
+    const size_t N = 64;
+    CachedLFO<PreciseLFO> cached;
+    PreciseLFO reference;
+    //A fractional increment, so the 64 bit render path is taken
+    cached.setFrequencyMilliHz(33333);
+    reference.setFrequencyMilliHz(33333);
+    LFO_CHECK(static_cast<uint32_t>(cached.getPhaseIncrement64()) != 0);
+    //Fill the cache, so a stale value would show up in the rendered block
+    cached.getValue();
+    LFOTPDFDither dither, referenceDither;
+    Format::Sample plain[N], dithered[N];
+    if (tickFirst)
+    {
+        cached.tickAndRenderOutput<Format>(plain, N);
+        cached.tickAndRenderOutput<Format>(dithered, N, dither);
+    }
+    else
+    {
+        cached.renderOutput<Format>(plain, N);
+        cached.renderOutput<Format>(dithered, N, dither);
+    }
+    unsigned long wrong = 0;
+    for (size_t s = 0; s < 2 * N; s++)
+    {
+        if (tickFirst) reference.tick();
+        Format::Sample expected = (s < N) ? reference.getOutput<Format>() : reference.getOutput<Format>(referenceDither);
+        if (((s < N) ? plain[s] : dithered[s - N]) != expected) wrong++;
+        if (!tickFirst) reference.tick();
+    }
+    LFO_CHECK(wrong == 0);
+    LFO_CHECK(cached.getPhase64() == reference.getPhase64());
+    LFO_CHECK(cached.getValue() == reference.getValue());
+}
+
+/**
+ * @brief StaticLFO must match a SoftwareLFO of the same waveform in setFrequencyExp() and every output function
+ */
+static void testStaticLFO()
+{
+    typedef LFOOutput10Bit Format;
+    const size_t N = 64;
+    StaticLFO<1> fixed;
+    SoftwareLFO<1> reference;
+    fixed.setFrequencyExp(-3 * 65536L + 12345);
+    reference.setFrequencyExp(-3 * 65536L + 12345);
+    LFO_CHECK(fixed.getPhaseIncrement() == reference.getPhaseIncrement());
+    LFOTPDFDither dither, referenceDither;
+    Format::Sample rendered[4 * N];
+    fixed.renderOutput<Format>(rendered, N);
+    fixed.renderOutput<Format>(rendered + N, N, dither);
+    fixed.tickAndRenderOutput<Format>(rendered + 2 * N, N);
+    fixed.tickAndRenderOutput<Format>(rendered + 3 * N, N, dither);
+    unsigned long wrong = 0;
+    for (size_t s = 0; s < 4 * N; s++)
+    {
+        bool tickFirst = (s >= 2 * N);
+        bool dithered = ((s / N) % 2) != 0;
+        if (tickFirst) reference.tick();
+        Format::Sample expected = dithered ? reference.getOutput<Format>(referenceDither) : reference.getOutput<Format>();
+        if (rendered[s] != expected) wrong++;
+        if (!tickFirst) reference.tick();
+    }
+    LFO_CHECK(wrong == 0);
+    LFO_CHECK(fixed.getPhase() == reference.getPhase());
+    LFO_CHECK(fixed.getOutput<Format>() == reference.getOutput<Format>());
+    LFO_CHECK(fixed.getOutput<Format>(dither) == reference.getOutput<Format>(referenceDither));
+}
+
+void runFrequencyTests()
+{
+    Test::section("setFrequencyExp() error vs exp2() from MinFrequency to MaxFrequency");
+    testOctaveAccuracy<LFOCalculator<1, LFOCounter::PhaseBitDepth>>("LFOCalculator<1>");
+    testOctaveAccuracy<LFOCalculator<1000, LFOCounter::PhaseBitDepth>>("LFOCalculator<1000>");
+    testOctaveAccuracy<LFOCalculatorHz<48000, LFOCounter::PhaseBitDepth>>("LFOCalculatorHz<48000>");
+    testOctaveAccuracy<LFOCalculatorUs<500, LFOCounter::PhaseBitDepth>>("LFOCalculatorUs<500>");
+    testOctaveAccuracy<LFOCalculator<1>>("LFOCalculator<1> (24 bit)");
+
+    Test::section("RuntimeLFOCalculator vs the compile time calculators");
+    testRuntimeCalculator<LFOCalculator<1, LFOCounter::PhaseBitDepth>>("LFOCalculator<1>");
+    testRuntimeCalculator<LFOCalculator<7, LFOCounter::PhaseBitDepth>>("LFOCalculator<7>");
+    testRuntimeCalculator<LFOCalculatorHz<48000, LFOCounter::PhaseBitDepth>>("LFOCalculatorHz<48000>");
+    testRuntimeCalculator<LFOCalculatorUs<500, LFOCounter::PhaseBitDepth>>("LFOCalculatorUs<500>");
+    testRuntimeCalculator<LFOCalculator<1>>("LFOCalculator<1> (24 bit)");
+    testLongDivide();
+    testLongMultiplyDivide();
+
+    Test::section("ClockedLFO::update()");
+    testClockedLFO();
+
+    Test::section("ExtendedPrecisionLFO output rendering");
+    testExtendedPrecisionRender(false);
+    testExtendedPrecisionRender(true);
+
+    Test::section("StaticLFO setFrequencyExp() and output rendering");
+    testStaticLFO();
+}
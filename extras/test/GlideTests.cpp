@@ -0,0 +1,253 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file GlideTests.cpp 
+//!  @brief Tests of GlidingLFO frequency glides
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#include "Test.h"
+#include "SoftwareLFO.h"
+#include "CachedLFO.h"
+#include "ClockedLFO.h"
+#include "ExtendedPrecisionLFO.h"
+#include "GlidingLFO.h"
+#include <math.h>
+
+typedef GlidingLFO<DeluxeSoftwareLFO<1>> GlideLFO;
+
+/**
+ * @brief A glide must take exactly timeMs ticks at 1 ms and end exactly on the target
+ */
+static void testGlideLength(uint32_t from, uint32_t to, uint32_t timeMs, LFOGlideShape shape)
+{
+    GlideLFO lfo;
+    lfo.setPhaseIncrement(from);
+    lfo.glideToPhaseIncrement(to, timeMs, shape);
+    uint32_t ticks = 0;
+    while (lfo.isGliding() && (ticks <= timeMs))
+    {
+        lfo.tick();
+        ticks++;
+    }
+    LFO_CHECK(ticks == ((from == to) ? 0 : timeMs));
+    LFO_CHECK(lfo.getPhaseIncrement() == to);
+}
+
+/**
+ * @brief A linear glide across more than half the increment range must move steadily in one direction
+ */
+static void testWideGlide(uint32_t from, uint32_t to)
+{
+    const uint32_t timeMs = 1000;
+    GlideLFO lfo;
+    lfo.setPhaseIncrement(from);
+    lfo.glideToPhaseIncrement(to, timeMs);
+    unsigned long backwards = 0;
+    uint32_t previous = from;
+    for (uint32_t t = 0; t < timeMs; t++)
+    {
+        lfo.tick();
+        uint32_t increment = lfo.getPhaseIncrement();
+        if ((to > from) ? (increment < previous) : (increment > previous)) backwards++;
+        previous = increment;
+        if (t == timeMs / 2 - 1) LFO_CHECK(fabs(increment - (from + (static_cast<double>(to) - from) / 2)) < timeMs);
+    }
+    LFO_CHECK(backwards == 0);
+    LFO_CHECK(lfo.getPhaseIncrement() == to);
+}
+
+/**
+ * @brief advance() and update() must follow a glide exactly like tick()
+ */
+static void testAdvance()
+{
+    GlideLFO ticked, advanced;
+    ClockedLFO<GlideLFO> updated;
+    GlideLFO *lfos[] = { &ticked, &advanced, &updated };
+    for (GlideLFO *lfo : lfos)
+    {
+        lfo->setFrequency(0.5f);
+        lfo->glideToFrequency(40.0f, 3000, LFOGlideShape::Exponential);
+    }
+    uint32_t now = 0;
+    for (uint32_t step = 1; step < 400; step += 7)
+    {
+        for (uint32_t i = 0; i < step; i++) ticked.tick();
+        advanced.advance(step);
+        now += step;
+        updated.update(now);
+        LFO_CHECK(ticked.getPhase() == advanced.getPhase());
+        LFO_CHECK(ticked.getPhaseIncrement() == advanced.getPhaseIncrement());
+        LFO_CHECK(ticked.getPhase() == updated.getPhase());
+    }
+    LFO_CHECK(!ticked.isGliding());
+}
+
+/**
+ * @brief Setting the frequency stops a glide, and a tick rate change jumps to its target
+ */
+static void testInterrupt()
+{
+    GlideLFO lfo;
+    lfo.setFrequency(1.0f);
+    lfo.glideToFrequency(10.0f, 1000);
+    lfo.advance(10);
+    lfo.setFrequencyMilliHz(2000);
+    LFO_CHECK(!lfo.isGliding());
+    const uint32_t increment = lfo.getPhaseIncrement();
+    lfo.advance(10);
+    LFO_CHECK(lfo.getPhaseIncrement() == increment);
+
+    GlidingLFO<RuntimeSoftwareLFO<>> runtime;
+    runtime.setFrequency(1.0f);
+    runtime.glideToFrequency(10.0f, 1000);
+    runtime.advance(10);
+    runtime.setTickRateMs(2);
+    LFO_CHECK(!runtime.isGliding());
+    LFO_CHECK(runtime.getPhaseIncrement() == runtime.getIncrementValueForFrequency(10.0f));
+}
+
+/**
+ * @brief The output rendered by a gliding LFO inside a CachedLFO must match a per-tick reference
+ * 
+ * @param tickFirst Test tickAndRenderOutput() instead of renderOutput()
+ */
+static void testCachedRender(bool tickFirst)
+{
+    typedef LFOOutputSigned16Bit Format;
+    const size_t N = 64;
+    CachedLFO<GlideLFO> cached;
+    GlideLFO reference;
+    cached.setFrequency(1.0f);
+    reference.setFrequency(1.0f);
+    cached.glideToFrequency(20.0f, 1000);
+    reference.glideToFrequency(20.0f, 1000);
+    //Fill the cache, so a stale value would show up in the rendered block
+    cached.getValue();
+    LFOTPDFDither dither, referenceDither;
+    Format::Sample plain[N], dithered[N];
+    if (tickFirst)
+    {
+        cached.tickAndRenderOutput<Format>(plain, N);
+        cached.tickAndRenderOutput<Format>(dithered, N, dither);
+    }
+    else
+    {
+        cached.renderOutput<Format>(plain, N);
+        cached.renderOutput<Format>(dithered, N, dither);
+    }
+    unsigned long wrong = 0;
+    for (size_t s = 0; s < 2 * N; s++)
+    {
+        if (tickFirst) reference.tick();
+        Format::Sample expected = (s < N) ? reference.getOutput<Format>() : reference.getOutput<Format>(referenceDither);
+        if (((s < N) ? plain[s] : dithered[s - N]) != expected) wrong++;
+        if (!tickFirst) reference.tick();
+    }
+    LFO_CHECK(wrong == 0);
+    LFO_CHECK(cached.isGliding());
+    LFO_CHECK(cached.getValue() == reference.getValue());
+}
+
+/**
+ * @brief advance() during a glide must go through the wrapped LFO's advance(), so a cache or fraction inside stays right
+ * 
+ * @tparam INNER The wrapped LFO (a CachedLFO or ExtendedPrecisionLFO)
+ */
+template <class INNER>
+static void testWrappedAdvance()
+{
+    GlidingLFO<INNER> ticked, advanced;
+    GlidingLFO<INNER> *lfos[] = { &ticked, &advanced };
+    for (GlidingLFO<INNER> *lfo : lfos)
+    {
+        lfo->setPhase(0x12345678UL);
+        lfo->setFrequency(0.5f);
+        lfo->glideToFrequency(40.0f, 3000, LFOGlideShape::Exponential);
+    }
+    unsigned long wrong = 0;
+    for (uint32_t step = 1; step < 400; step += 7)
+    {
+        //Fill any cache, so a stale value would show up after the advance
+        advanced.getValue();
+        for (uint32_t i = 0; i < step; i++) ticked.tick();
+        advanced.advance(step);
+        if ((ticked.getPhase() != advanced.getPhase()) || (ticked.getPhaseIncrement() != advanced.getPhaseIncrement()) || 
+            (ticked.getValue() != advanced.getValue())) wrong++;
+    }
+    LFO_CHECK(wrong == 0);
+    LFO_CHECK(!advanced.isGliding());
+}
+
+void runGlideTests()
+{
+    Test::section("GlidingLFO");
+    testGlideLength(0x00010000UL, 0x00050000UL, 2000, LFOGlideShape::Linear);
+    testGlideLength(0x00500000UL, 0x00001000UL, 1000, LFOGlideShape::Linear);
+    testGlideLength(0x00010000UL, 0x00050000UL, 2000, LFOGlideShape::Exponential);
+    testGlideLength(0x00500000UL, 0x00001000UL, 1000, LFOGlideShape::Exponential);
+    testGlideLength(0x00010000UL, 0x00010000UL, 100, LFOGlideShape::Linear);
+    testGlideLength(0x00010000UL, 0x00020000UL, 7, LFOGlideShape::Exponential);
+    testWideGlide(1, 0xFFFFFFF0UL);
+    testWideGlide(0xFFFFFFFFUL, 0x10);
+    testWideGlide(0x10000000UL, 0xA0000000UL);
+    testAdvance();
+    testInterrupt();
+    testCachedRender(false);
+    testCachedRender(true);
+    testWrappedAdvance<CachedLFO<DeluxeSoftwareLFO<1>>>();
+    testWrappedAdvance<CachedLFO<DeluxeSoftwareLFO<1>, LFOCacheMode::Eager>>();
+    testWrappedAdvance<ExtendedPrecisionLFO<DeluxeSoftwareLFO<1>>>();
+    //Plain LFOs do not carry the glide state
+    LFO_CHECK(sizeof(DeluxeSoftwareLFO<1>) + sizeof(LFOGlide) <= sizeof(GlideLFO));
+}
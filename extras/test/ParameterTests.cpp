@@ -0,0 +1,176 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file ParameterTests.cpp 
+//!  @brief Tests of the AtomicLFO parameter buffer
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#include "Test.h"
+#include "SoftwareLFO.h"
+#include "AtomicLFO.h"
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <chrono>
+
+static constexpr unsigned int NumWriters = 2;
+
+/**
+ * @brief AtomicLFO exposing the applied waveform table and the newest published update
+ */
+class ProbeLFO: public AtomicLFO<DeluxeSoftwareLFO<1>>
+{
+    public:
+        EightBitWaveforms::Table getWavetable() const { return wavetable; }
+        uint32_t getPublishedIncrement() const { return latest(sequence.load()).increment; }
+};
+
+/**
+ * @brief Parameters written by the writers: both increment halves and the waveform derive from one number
+ */
+static uint32_t testIncrement(uint32_t x) { return (x << 16) | x; }
+static LFOWaveform testWaveform(uint32_t x) { return static_cast<LFOWaveform>(x % static_cast<uint32_t>(LFOWaveform::N_WAVEFORMS)); }
+
+/**
+ * @brief Every setter publishes through the buffer and leaves the running LFO alone until the next tick
+ */
+static void testSetters()
+{
+    ProbeLFO lfo;
+    lfo.setIncrementValue(1234);
+    lfo.setDepth(LFOScaling::FullDepth / 2);
+    lfo.setOffset(LFOScaling::Center);
+    lfo.setPolarity(LFOPolarity::Bipolar);
+    lfo.setWaveform(LFOWaveform::Square);
+    LFO_CHECK(lfo.getIncrementValue() == 0);
+    LFO_CHECK(lfo.getDepth() == LFOScaling::FullDepth);
+    LFO_CHECK(lfo.getOffset() == 0);
+    LFO_CHECK(lfo.getPolarity() == LFOPolarity::Unipolar);
+    LFO_CHECK(lfo.getWavetable() == EightBitWaveforms::getTable(LFOWaveform::Sine));
+
+    lfo.tick();
+    LFO_CHECK(lfo.getIncrementValue() == 1234);
+    LFO_CHECK(lfo.getDepth() == LFOScaling::FullDepth / 2);
+    LFO_CHECK(lfo.getOffset() == LFOScaling::Center);
+    LFO_CHECK(lfo.getPolarity() == LFOPolarity::Bipolar);
+    LFO_CHECK(lfo.getWavetable() == EightBitWaveforms::getTable(LFOWaveform::Square));
+
+    lfo.setFrequencyExp(3 << 16);
+    LFO_CHECK(lfo.getIncrementValue() == 1234);
+    lfo.tick();
+    LFO_CHECK(lfo.getPhaseIncrement() == lfo.getIncrementValueForOctave(3 << 16));
+    //The other parameters are carried over from the previous update
+    LFO_CHECK(lfo.getDepth() == LFOScaling::FullDepth / 2);
+    LFO_CHECK(lfo.getWavetable() == EightBitWaveforms::getTable(LFOWaveform::Square));
+}
+
+/**
+ * @brief Writers publish parameter sets while this thread ticks the LFO and checks every applied set
+ */
+static void testConcurrentWriters()
+{
+    ProbeLFO lfo;
+    std::atomic<bool> done(false);
+    std::atomic<unsigned long> published(0);
+    std::vector<std::thread> writers;
+    for (unsigned int w = 0; w < NumWriters; w++)
+    {
+        writers.emplace_back([&, w]{
+            unsigned long count = 0;
+            for (uint32_t x = w + 1; !done.load(std::memory_order_relaxed); x = (x + NumWriters) & 0xFFFF)
+            {
+                lfo.setParameters(testIncrement(x), testWaveform(x));
+                count++;
+            }
+            published += count;
+        });
+    }
+
+    unsigned long ticks = 0, changes = 0, torn = 0;
+    uint32_t previous = 0;
+    auto begin = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - begin < std::chrono::milliseconds(300))
+    {
+        for (int i = 0; i < 1000; i++)
+        {
+            lfo.tick();
+            uint32_t increment = lfo.getPhaseIncrement();
+            uint32_t x = increment & 0xFFFF;
+            if (increment == previous) continue;
+            previous = increment;
+            changes++;
+            if (((increment >> 16) != x) || (lfo.getWavetable() != EightBitWaveforms::getTable(testWaveform(x)))) torn++;
+        }
+        ticks += 1000;
+    }
+    done.store(true);
+    for (std::thread &writer : writers) writer.join();
+    printf("  %u writers, %lu updates published, %lu ticks, %lu applied, %lu torn\n",
+           NumWriters, published.load(), ticks, changes, torn);
+    LFO_CHECK(published.load() > 0);
+    LFO_CHECK(changes > 0);
+    LFO_CHECK(torn == 0);
+
+    //The last update is applied at the first tick after the writes stop
+    lfo.tick();
+    uint32_t increment = lfo.getPhaseIncrement();
+    LFO_CHECK(increment == lfo.getPublishedIncrement());
+    LFO_CHECK(lfo.getWavetable() == EightBitWaveforms::getTable(testWaveform(increment & 0xFFFF)));
+}
+
+void runParameterTests()
+{
+    Test::section("AtomicLFO parameter updates");
+    testSetters();
+    testConcurrentWriters();
+}
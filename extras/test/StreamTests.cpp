@@ -0,0 +1,128 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file StreamTests.cpp 
+//!  @brief Tests of LFOStreamBuffer with a simulated DMA channel
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#include "Test.h"
+#include "../benchmark/StreamSimulation.h"
+
+using namespace StreamSimulation;
+
+/**
+ * @brief Underruns and dropped blocks, stepping the DMA by hand
+ */
+static void testDroppedBlocks()
+{
+    StreamLFO lfos[Channels];
+    StreamLFO reference[Channels];
+    setupLFOs(lfos);
+    setupLFOs(reference);
+    Stream stream;
+    for (size_t c = 0; c < Channels; c++) stream.attach(c, lfos[c]);
+    stream.prime();
+    const uint16_t *first = stream.getBuffer();
+    const uint16_t *second = first + Stream::HalfSize;
+
+    LFO_CHECK(match(reference, first, 0) == 0);
+    stream.onHalfComplete();
+    //fill() is late, so the DMA goes on to replay the first half
+    LFO_CHECK(match(reference, second, 0) == 0);
+    stream.onComplete();
+    LFO_CHECK(stream.getUnderruns() == 1);
+    //The DMA is replaying the first half, so its new block is dropped
+    stream.fill();
+    LFO_CHECK(stream.getDropped() == 1);
+    stream.onHalfComplete();
+    LFO_CHECK(stream.getUnderruns() == 1);
+    StreamLFO copy[Channels];
+    std::copy(reference, reference + Channels, copy);
+    LFO_CHECK(match(copy, second, 0) == -1);
+    LFO_CHECK(match(reference, second, 1) == 1);
+    //Back in time
+    stream.fill();
+    stream.onComplete();
+    LFO_CHECK(match(reference, first, 0) == 0);
+    LFO_CHECK(stream.getUnderruns() == 1);
+    LFO_CHECK(stream.getDropped() == 1);
+}
+
+static void reportSimulation(const char *name, const Result &result)
+{
+    printf("  %s: %lu halves, %lu underruns, %lu replayed, %lu dropped, %lu skipped, %lu wrong\n",
+           name, result.halves, static_cast<unsigned long>(result.underruns), result.replayed,
+           static_cast<unsigned long>(result.dropped), result.skipped, result.wrong);
+}
+
+void runStreamTests()
+{
+    Test::section("LFOStreamBuffer with a simulated DMA at 48 kHz");
+    testDroppedBlocks();
+
+    Result result = simulate(1.0, 0);
+    reportSimulation("no stalls", result);
+    LFO_CHECK(result.halves > 0);
+    LFO_CHECK(result.underruns == 0);
+    LFO_CHECK(result.replayed == 0);
+    LFO_CHECK(result.dropped == 0);
+    LFO_CHECK(result.wrong == 0);
+
+    //12 ms stalls are longer than two half periods
+    result = simulate(0.5, 12);
+    reportSimulation("12 ms stalls every 50 ms", result);
+    LFO_CHECK(result.underruns > 0);
+    LFO_CHECK(result.replayed > 0);
+    LFO_CHECK(result.wrong == 0);
+    LFO_CHECK(result.skipped <= result.dropped);
+}
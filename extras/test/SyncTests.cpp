@@ -0,0 +1,170 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file SyncTests.cpp 
+//!  @brief Phase and clock skew tests of SyncedLFO with simulated board clocks
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#include "Test.h"
+#include "SoftwareLFO.h"
+#include "SyncedLFO.h"
+#include <math.h>
+#include <stdlib.h>
+
+typedef SyncedLFO<SoftwareLFO<1>> BoardLFO;
+
+static constexpr unsigned int Boards = 4;
+
+/**
+ * @brief Clock skew of each simulated board in ppm (positive ticks faster than the shared clock)
+ */
+static const double BoardSkewPpm[Boards] = { -200.0, 50.0, 300.0, 1000.0 };
+
+/**
+ * @brief Sync once every SyncInterval ticks
+ */
+static constexpr uint32_t SyncInterval = 1000;
+
+/**
+ * @brief Run boards with skewed clocks for 10 minutes of 1 ms ticks, syncing once a second
+ * 
+ * The learned skew must be within (2 + 2 * jitter) ticks over the shortest baseline 
+ * (2^gainShift syncs), and the phase error in the last minute within (1 + 2 * jitter) ticks.
+ * 
+ * @param jitterTicks The maximum error of each received tick count
+ * @param gainShift The setSyncGain() of the boards
+ */
+static void testBoards(uint32_t jitterTicks, uint8_t gainShift)
+{
+    const uint32_t duration = 600000;
+    BoardLFO boards[Boards];
+    uint64_t localTicks[Boards];
+    for (unsigned int b = 0; b < Boards; b++)
+    {
+        boards[b].setFrequencyMilliHz(500);
+        boards[b].setSyncGain(gainShift);
+        boards[b].setPhaseFromTime(0);
+        localTicks[b] = 0;
+    }
+    srand(1);
+    const uint32_t nominal = boards[0].getNominalIncrement();
+    double worstTicks = 0;
+    for (uint32_t shared = 1; shared <= duration; shared++)
+    {
+        for (unsigned int b = 0; b < Boards; b++)
+        {
+            uint64_t target = static_cast<uint64_t>(floor(shared * (1.0 + BoardSkewPpm[b] * 1e-6)));
+            boards[b].advance(static_cast<uint32_t>(target - localTicks[b]));
+            localTicks[b] = target;
+            if (shared % SyncInterval == 0)
+            {
+                int32_t jitter = jitterTicks ? (rand() % (2 * jitterTicks + 1)) - static_cast<int32_t>(jitterTicks) : 0;
+                boards[b].syncToTime(shared + jitter);
+            }
+            if (shared > duration - 60000)
+            {
+                int32_t error = static_cast<int32_t>(shared * nominal - boards[b].getPhase());
+                worstTicks = fmax(worstTicks, fabs(static_cast<double>(error)) / nominal);
+            }
+        }
+    }
+
+    const double skewTolerancePpm = (2.0 + 2.0 * jitterTicks) / (static_cast<double>(SyncInterval) * (1UL << gainShift)) * 1e6;
+    double worstSkewPpm = 0;
+    for (unsigned int b = 0; b < Boards; b++)
+    {
+        //The increment must be scaled by the inverse of the clock rate
+        double expected = (1.0 / (1.0 + BoardSkewPpm[b] * 1e-6) - 1.0) * 1e6;
+        double learned = boards[b].getSkew() / 2147483648.0 * 1e6;
+        worstSkewPpm = fmax(worstSkewPpm, fabs(learned - expected));
+    }
+    printf("  jitter %u, gain %u: worst phase error %.4f ticks (limit %u), worst skew error %.1f ppm (limit %.1f)\n",
+           jitterTicks, gainShift, worstTicks, 1 + 2 * jitterTicks, worstSkewPpm, skewTolerancePpm);
+    LFO_CHECK(worstTicks <= 1 + 2 * jitterTicks);
+    LFO_CHECK(worstSkewPpm <= skewTolerancePpm);
+}
+
+/**
+ * @brief The learned skew is a ratio, so it is kept when the frequency changes
+ */
+static void testFrequencyChange()
+{
+    BoardLFO lfo;
+    lfo.setFrequencyMilliHz(500);
+    lfo.setPhaseFromTime(0);
+    uint64_t local = 0;
+    for (uint32_t shared = SyncInterval; shared <= 200 * SyncInterval; shared += SyncInterval)
+    {
+        uint64_t target = static_cast<uint64_t>(floor(shared * (1.0 + 300e-6)));
+        lfo.advance(static_cast<uint32_t>(target - local));
+        local = target;
+        lfo.syncToTime(shared);
+    }
+    int32_t skew = lfo.getSkew();
+    lfo.setFrequencyMilliHz(2000);
+    LFO_CHECK(lfo.getSkew() == skew);
+    LFO_CHECK(lfo.getPhaseIncrement() == lfo.getNominalIncrement() +
+              static_cast<uint32_t>(static_cast<int32_t>((static_cast<int64_t>(lfo.getNominalIncrement()) * skew) / (1LL << BoardLFO::SkewBits))));
+    lfo.resetSync();
+    LFO_CHECK(lfo.getSkew() == 0);
+    LFO_CHECK(!lfo.isSynced());
+}
+
+void runSyncTests()
+{
+    Test::section("SyncedLFO boards at -200, +50, +300 and +1000 ppm");
+    testBoards(0, 7);
+    testBoards(2, 7);
+    testBoards(2, 9);
+    testFrequencyChange();
+}
@@ -0,0 +1,390 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file AtomicLFO.h 
+//!  @brief AtomicLFO class definition
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#ifndef _ATOMIC_LFO_H_
+#define _ATOMIC_LFO_H_
+
+#include "LFOAtomic.h"
+#include "Waveforms/EightBitWaveforms.h"
+#include "LFOCounter.h"
+
+/**
+ * @brief Software LFO whose parameters can be changed while it runs in an interrupt or another thread
+ * 
+ * The setters do not modify the running oscillator.  They write a complete 
+ * parameter block (increment, waveform, depth, offset and polarity) into the 
+ * back half of a double buffer and publish it with a sequence counter.  The 
+ * oscillator picks up the newest block at its next tick boundary (tick(), 
+ * advance(), render() or tickAndRender() of the AtomicLFO), so it 
+ * never sees half of an update, and neither side locks or disables 
+ * interrupts.  While an update is being written, ticks use the last 
+ * complete update (the other half of the buffer).  Checking for an update 
+ * costs one load and compare per tick.
+ * 
+ * Every parameter setter of the wrapped LFO publishes through the buffer.
+ * 
+ * tick() and advance() are not virtual, so the AtomicLFO must be ticked as 
+ * an AtomicLFO: directly, or by an LFOScheduler it was added to (which calls 
+ * the tick() of the type passed to add()).  Ticked through a BaseLFO pointer 
+ * it would never apply the published updates.
+ * 
+ * On Arduino targets the setters must all be called from the same context
+ * (for example the main loop, while the LFO ticks in a timer interrupt).  On
+ * the host build several threads may call them.
+ * 
+ *     AtomicLFO<DeluxeSoftwareLFO<1>> LFO;
+ *     ISR(TIMER1_COMPA_vect){ LFO.tick(); }
+ *     //In loop():
+ *     LFO.setFrequency(2.0f);
+ * 
+ * @tparam LFO - The LFO class (SoftwareLFO, DeluxeSoftwareLFO or a variant)
+ */
+template <class LFO>
+class AtomicLFO: public LFO
+{
+    public:
+        /**
+         * @brief Construct a new AtomicLFO object
+         */
+        AtomicLFO(): sequence(0), applied(0)
+        {
+            //The first update starts from the wrapped LFO's defaults
+            Parameters &initial = buffers[0];
+            initial.increment.store(LFO::getPhaseIncrement());
+            initial.depth.store(LFO::getDepth());
+            initial.offset.store(LFO::getOffset());
+            initial.waveform.store(static_cast<uint8_t>(LFOWaveform::Sine));
+            initial.polarity.store(static_cast<uint8_t>(LFO::getPolarity()));
+        }
+
+        inline void setPeriod(float periodSeconds)
+        {
+            setPhaseIncrement(this->getIncrementValueForPeriod(periodSeconds));
+        }
+
+        inline void setFrequency(float freqHertz)
+        {
+            setPhaseIncrement(this->getIncrementValueForFrequency(freqHertz));
+        }
+
+        inline void setPeriodMs(uint32_t periodMilliseconds)
+        {
+            setPhaseIncrement(this->getIncrementValueForPeriodMs(periodMilliseconds));
+        }
+
+        inline void setFrequencyMilliHz(uint32_t freqMilliHertz)
+        {
+            setPhaseIncrement(this->getIncrementValueForFrequencyMilliHz(freqMilliHertz));
+        }
+
+        inline void setFrequencyExp(int32_t octaves)
+        {
+            setPhaseIncrement(this->getIncrementValueForOctave(octaves));
+        }
+
+        inline void setIncrementValue(uint32_t value)
+        {
+            setPhaseIncrement(value << LFOCounter::PhaseShift);
+        }
+
+        /**
+         * @brief Publish a new 32 bit phase increment
+         * 
+         * @param phaseIncrement The new phase increment
+         */
+        void setPhaseIncrement(uint32_t phaseIncrement)
+        {
+            LFOAtomic::Sequence s = claim();
+            Values values = latest(s);
+            values.increment = phaseIncrement;
+            write(s, values);
+        }
+
+        /**
+         * @brief Publish a new waveform (ignored by sine only LFO's)
+         * 
+         * @param waveform The new waveform
+         */
+        void setWaveform(LFOWaveform waveform)
+        {
+            LFOAtomic::Sequence s = claim();
+            Values values = latest(s);
+            values.waveform = static_cast<uint8_t>(waveform);
+            write(s, values);
+        }
+
+        /**
+         * @brief Publish a new output depth (see LFOScaling)
+         * 
+         * @param depth The new depth
+         */
+        void setDepth(uint32_t depth)
+        {
+            LFOAtomic::Sequence s = claim();
+            Values values = latest(s);
+            values.depth = depth;
+            write(s, values);
+        }
+
+        /**
+         * @brief Publish a new output offset (see LFOScaling)
+         * 
+         * @param offset The new offset
+         */
+        void setOffset(uint32_t offset)
+        {
+            LFOAtomic::Sequence s = claim();
+            Values values = latest(s);
+            values.offset = offset;
+            write(s, values);
+        }
+
+        /**
+         * @brief Publish a new output polarity (see LFOScaling)
+         * 
+         * @param polarity The new polarity
+         */
+        void setPolarity(LFOPolarity polarity)
+        {
+            LFOAtomic::Sequence s = claim();
+            Values values = latest(s);
+            values.polarity = static_cast<uint8_t>(polarity);
+            write(s, values);
+        }
+
+        /**
+         * @brief Publish a new phase increment and waveform together
+         * 
+         * @param phaseIncrement The new phase increment
+         * @param waveform The new waveform
+         */
+        void setParameters(uint32_t phaseIncrement, LFOWaveform waveform)
+        {
+            LFOAtomic::Sequence s = claim();
+            Values values = latest(s);
+            values.increment = phaseIncrement;
+            values.waveform = static_cast<uint8_t>(waveform);
+            write(s, values);
+        }
+
+        inline void tick()
+        {
+            apply();
+            LFO::tick();
+        }
+
+        inline void advance(uint32_t ticks)
+        {
+            apply();
+            LFO::advance(ticks);
+        }
+
+        void render(uint32_t *out, size_t n)
+        {
+            apply();
+            LFO::render(out, n);
+        }
+
+        void tickAndRender(uint32_t *out, size_t n)
+        {
+            apply();
+            LFO::tickAndRender(out, n);
+        }
+
+        template <class FORMAT, class... DITHER>
+        void renderOutput(typename FORMAT::Sample *out, size_t n, DITHER &... dither)
+        {
+            apply();
+            LFO::template renderOutput<FORMAT>(out, n, dither...);
+        }
+
+        template <class FORMAT, class... DITHER>
+        void tickAndRenderOutput(typename FORMAT::Sample *out, size_t n, DITHER &... dither)
+        {
+            apply();
+            LFO::template tickAndRenderOutput<FORMAT>(out, n, dither...);
+        }
+
+        /**
+         * @brief Apply the newest published parameters now
+         * 
+         * Called by the tick functions, only call this from the context that 
+         * ticks the LFO.  The newest complete update is always applied: a 
+         * read only fails if the writers published two more updates while 
+         * it was copying the parameters (so the half it read was reused), 
+         * and it is then retried with the newer update.  On Arduino targets 
+         * the setters can not interrupt the tick, so the first read always 
+         * succeeds.
+         */
+        inline void apply()
+        {
+            //While an update is being written (odd sequence) the last complete one is still valid
+            LFOAtomic::Sequence s = sequence.loadAcquire() & ~static_cast<LFOAtomic::Sequence>(1);
+            if (s == applied) return;
+            Values values;
+            while (!read(s, values))
+            {
+                s = sequence.loadAcquire() & ~static_cast<LFOAtomic::Sequence>(1);
+            }
+            LFO::setPhaseIncrement(values.increment);
+            applyWaveform(static_cast<LFO &>(*this), static_cast<LFOWaveform>(values.waveform), 0);
+            LFO::setPolarity(static_cast<LFOPolarity>(values.polarity));
+            LFO::setDepth(values.depth);
+            LFO::setOffset(values.offset);
+            applied = s;
+        }
+
+    protected:
+        /**
+         * @brief A complete set of parameters
+         */
+        struct Parameters
+        {
+            LFOShared<uint32_t> increment;  //!< The 32 bit phase increment
+            LFOShared<uint32_t> depth;      //!< The output depth
+            LFOShared<uint32_t> offset;     //!< The output offset
+            LFOShared<uint8_t> waveform;    //!< The LFOWaveform
+            LFOShared<uint8_t> polarity;    //!< The LFOPolarity
+        };
+
+        /**
+         * @brief A copy of a set of parameters
+         */
+        struct Values
+        {
+            uint32_t increment;
+            uint32_t depth;
+            uint32_t offset;
+            uint8_t waveform;
+            uint8_t polarity;
+        };
+
+        /**
+         * @brief Claim the buffer for writing (waits only for other writers)
+         * 
+         * @return LFOAtomic::Sequence The sequence of the latest published parameters
+         */
+        LFOAtomic::Sequence claim()
+        {
+            LFOAtomic::Sequence s = sequence.load();
+            while ((s & 1) || !sequence.compareExchange(s, static_cast<LFOAtomic::Sequence>(s + 1)))
+            {
+                s = sequence.load();
+            }
+            LFOAtomic::releaseFence();
+            return s;
+        }
+
+        /**
+         * @brief Copy the latest published parameters (only while the buffer is claimed)
+         */
+        Values latest(LFOAtomic::Sequence s) const
+        {
+            const Parameters &current = buffers[(s >> 1) & 1];
+            Values values;
+            values.increment = current.increment.load();
+            values.depth = current.depth.load();
+            values.offset = current.offset.load();
+            values.waveform = current.waveform.load();
+            values.polarity = current.polarity.load();
+            return values;
+        }
+
+        /**
+         * @brief Copy the parameters published at a sequence
+         * 
+         * @return true If the copy is complete (the half of the buffer was not reused meanwhile)
+         */
+        bool read(LFOAtomic::Sequence s, Values &values) const
+        {
+            values = latest(s);
+            LFOAtomic::acquireFence();
+            //The other half of the buffer may be written meanwhile, but not this half
+            return static_cast<LFOAtomic::Sequence>(sequence.load() - s) <= 2;
+        }
+
+        /**
+         * @brief Write the back buffer and publish it
+         */
+        void write(LFOAtomic::Sequence s, const Values &values)
+        {
+            Parameters &next = buffers[((s >> 1) + 1) & 1];
+            next.increment.store(values.increment);
+            next.depth.store(values.depth);
+            next.offset.store(values.offset);
+            next.waveform.store(values.waveform);
+            next.polarity.store(values.polarity);
+            sequence.storeRelease(static_cast<LFOAtomic::Sequence>(s + 2));
+        }
+
+        template <class T>
+        static auto applyWaveform(T &lfo, LFOWaveform waveform, int) -> decltype(lfo.setWaveform(waveform), void())
+        {
+            lfo.setWaveform(waveform);
+        }
+
+        template <class T>
+        static void applyWaveform(T &, LFOWaveform, long)
+        {
+        }
+
+        Parameters buffers[2];                  //!< The double buffered parameters
+        LFOShared<LFOAtomic::Sequence> sequence; //!< Twice the number of published updates (odd while writing)
+        LFOAtomic::Sequence applied;            //!< The sequence of the applied parameters
+};
+
+#endif
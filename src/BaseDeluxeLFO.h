@@ -62,36 +62,132 @@
 #include "Waveforms/EightBitWaveforms.h"
 
 /**
- * @brief Base class for Deluxe Software LFO's
+ * @brief Template base class for Deluxe Software LFO's
  * 
- *  This class provides switchable LFO waveforms
+ *  This class provides switchable LFO waveforms read from the tables 
+ *  of the supplied waveform class
+ * 
+ * @tparam WAVEFORMS - The waveform table class (EightBitWaveforms or EightBitDeltaWaveforms)
+ * @tparam INTERPOLATION - The interpolation policy (TruncatingInterpolation, LinearInterpolation or HermiteInterpolation)
  */
-class BaseDeluxeLFO: public BaseLFO
+template <class WAVEFORMS, class INTERPOLATION = LinearInterpolation>
+class BasicDeluxeLFO: public BaseLFO
 {
     public:
         /**
-         * @brief Construct a new BaseDeluxeLFO object
+         * @brief Construct a new BasicDeluxeLFO object
          */
-        BaseDeluxeLFO(): wavetable(EightBitWaveforms::sine){}
+        BasicDeluxeLFO(): wavetable(WAVEFORMS::getTable(LFOWaveform::Sine)){}
 
         /**
          * @brief Get the oscillators output value
          * 
          * @return uint32_t The oscillators 24 bit output 
          */
-        uint32_t getValue() const;
+        uint32_t getValue() const
+        {
+            return scaling.apply(INTERPOLATION::template interpolate<WAVEFORMS>(wavetable, counter));
+        }
+
+        /**
+         * @brief Render a block of output values from the selected waveform
+         * 
+         * @param out Buffer receiving the 24 bit output values
+         * @param n The number of values to render
+         */
+        void render(uint32_t *out, size_t n)
+        {
+            this->template renderTable<WAVEFORMS, INTERPOLATION>(wavetable, scaling, out, n);
+        }
+
+        /**
+         * @brief Tick the oscillator and render a block of output values from the selected waveform
+         * 
+         * @param out Buffer receiving the 24 bit output values
+         * @param n The number of values to render
+         */
+        void tickAndRender(uint32_t *out, size_t n)
+        {
+            this->template tickAndRenderTable<WAVEFORMS, INTERPOLATION>(wavetable, scaling, out, n);
+        }
+
+        /**
+         * @brief Render a block of output samples in a DAC/PWM format (see render())
+         * 
+         * @tparam FORMAT The output format (such as LFOOutput10Bit or LFOOutputSigned16Bit)
+         * @param out Buffer receiving the output samples
+         * @param n The number of samples to render
+         */
+        template <class FORMAT>
+        void renderOutput(typename FORMAT::Sample *out, size_t n)
+        {
+            LFONoDither dither;
+            renderOutput<FORMAT>(out, n, dither);
+        }
+
+        /**
+         * @brief Render a block of dithered output samples in a DAC/PWM format (see render())
+         * 
+         * @tparam FORMAT The output format (such as LFOOutput10Bit or LFOOutputSigned16Bit)
+         * @tparam DITHER The dither class (LFONoDither, LFOTPDFDither or LFONoiseShapedDither)
+         * @param out Buffer receiving the output samples
+         * @param n The number of samples to render
+         * @param dither The dither state (keep one per output)
+         */
+        template <class FORMAT, class DITHER>
+        void renderOutput(typename FORMAT::Sample *out, size_t n, DITHER &dither)
+        {
+            this->template renderTableOutput<WAVEFORMS, INTERPOLATION, FORMAT>(wavetable, scaling, out, n, dither);
+        }
+
+        /**
+         * @brief Tick and render a block of output samples in a DAC/PWM format (see tickAndRender())
+         * 
+         * @tparam FORMAT The output format (such as LFOOutput10Bit or LFOOutputSigned16Bit)
+         * @param out Buffer receiving the output samples
+         * @param n The number of samples to render
+         */
+        template <class FORMAT>
+        void tickAndRenderOutput(typename FORMAT::Sample *out, size_t n)
+        {
+            LFONoDither dither;
+            tickAndRenderOutput<FORMAT>(out, n, dither);
+        }
+
+        /**
+         * @brief Tick and render a block of dithered output samples in a DAC/PWM format (see tickAndRender())
+         * 
+         * @tparam FORMAT The output format (such as LFOOutput10Bit or LFOOutputSigned16Bit)
+         * @tparam DITHER The dither class (LFONoDither, LFOTPDFDither or LFONoiseShapedDither)
+         * @param out Buffer receiving the output samples
+         * @param n The number of samples to render
+         * @param dither The dither state (keep one per output)
+         */
+        template <class FORMAT, class DITHER>
+        void tickAndRenderOutput(typename FORMAT::Sample *out, size_t n, DITHER &dither)
+        {
+            this->template tickAndRenderTableOutput<WAVEFORMS, INTERPOLATION, FORMAT>(wavetable, scaling, out, n, dither);
+        }
 
         /**
          * @brief Set the waveform of the oscillator
          * 
          * @param waveform The desired waveform
          */
-        void setWaveform(LFOWaveform waveform);
+        void setWaveform(LFOWaveform waveform)
+        {
+            wavetable = WAVEFORMS::getTable(waveform);
+        }
     protected:
         /**
          * @brief Pointer to the currently selected waveform's wavetable
          */
-        const uint8_t *wavetable;
+        typename WAVEFORMS::Table wavetable;
 };
 
-#endif
\ No newline at end of file
+/**
+ * @brief Base class for Deluxe Software LFO's using the 8-bit waveform tables
+ */
+typedef BasicDeluxeLFO<EightBitWaveforms> BaseDeluxeLFO;
+
+#endif
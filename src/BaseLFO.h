@@ -60,104 +60,113 @@
 #define _BASE_LFO_H_
 
 #include <Arduino.h>
+#include "LFOCounter.h"
+#include "Waveforms/EightBitWaveforms.h"
 
 /**
  * @brief Base class for Software LFO's.  
  * 
- *  Utilizes a 24 bit internal counter and provides sine output by default.
+ *  Utilizes a 24 bit internal counter and provides sine output by default
+ *  (read from the full 8-bit sine table).  Every output value is 
+ *  scaled by the depth and offset set with setDepth() and setOffset().
+ *  BaseLFO is the common, non-template base of every LFO, so it always 
+ *  interpolates linearly; BasicSineLFO<EightBitWaveforms, INTERPOLATION> 
+ *  (used by SoftwareLFO) is the same sine LFO with a selectable policy.
  * 
  */
-class BaseLFO
+class BaseLFO: public LFOCounter
 {
     public:
         /**
-         * @brief Bit Depth of the LFO's Internal Counter
-         */
-        static constexpr unsigned int CounterBitDepth = 24;
-        
-        /**
-         * @brief Number of counts (ticks) per oscillation period
-         */
-        static constexpr unsigned long CountsPerPeriod = (1 << CounterBitDepth);
-
-        /**
-         * @brief Construct a new BaseLFO object
-         */
-        BaseLFO(): tick_increment(0), counter(0){}
-
-        /**
-         * @brief Sets the increment value
+         * @brief Get the oscillators output value.
+         * 
+         *  This function is virtual, so it may be overriden to provide additional calculations
          * 
-         * @param value The new value (maximum value is CountsPerPeriod)
+         *  @return uint32_t The oscillators 24 bit output value.
          */
-        inline void setIncrementValue(uint32_t value){ tick_increment = value % CountsPerPeriod; };
+        virtual uint32_t getValue() const;
 
         /**
-         * @brief Increment the oscillator.
+         * @brief Render a block of output values
          * 
-         * This function should be called at a constant rate in order to "run" the oscillator
+         *  Equivalent to calling getValue() followed by tick() n times, but
+         *  performed in a single loop without a virtual call per sample.
          * 
+         * @param out Buffer receiving the 24 bit output values
+         * @param n The number of values to render
          */
-        inline void tick()
-        {
-            counter += tick_increment;
-            counter %= CountsPerPeriod;
-        }
+        virtual void render(uint32_t *out, size_t n);
 
         /**
-         * @brief Reset the oscillators internal counter to 0
+         * @brief Tick the oscillator and render a block of output values
+         * 
+         *  Equivalent to calling tick() followed by getValue() n times, but
+         *  performed in a single loop without a virtual call per sample.
          * 
+         * @param out Buffer receiving the 24 bit output values
+         * @param n The number of values to render
          */
-        inline void reset(){ counter = 0; }
+        virtual void tickAndRender(uint32_t *out, size_t n);
 
         /**
-         * @brief Get the oscillators output value.
+         * @brief Get the output value in a DAC/PWM format, rounded to the nearest level
          * 
-         *  This function is virtual, so it may be overriden to provide additional calculations
+         *      analogWrite(OUTPUT_PIN, LFO.getOutput<LFOOutput10Bit>());
          * 
-         *  @return uint32_t The oscillators 24 bit output value.
+         * @tparam FORMAT The output format (such as LFOOutput10Bit or LFOOutputSigned16Bit)
+         * @return FORMAT::Sample The output sample
          */
-        virtual uint32_t getValue() const;
+        template <class FORMAT>
+        typename FORMAT::Sample getOutput() const
+        {
+            LFONoDither dither;
+            return getOutput<FORMAT>(dither);
+        }
 
         /**
-         * @brief Gets the current counter value.
+         * @brief Get the output value in a DAC/PWM format, dithered
          * 
-         * @return uint32_t The oscillators 24 bit counter value
+         * @tparam FORMAT The output format (such as LFOOutput10Bit or LFOOutputSigned16Bit)
+         * @tparam DITHER The dither class (LFONoDither, LFOTPDFDither or LFONoiseShapedDither)
+         * @param dither The dither state (keep one per output)
+         * @return FORMAT::Sample The output sample
          */
-        uint32_t getCounter() const { return counter; };
+        template <class FORMAT, class DITHER>
+        typename FORMAT::Sample getOutput(DITHER &dither) const
+        {
+            return FORMAT::convert(dither.template quantize<FORMAT>(getValue()));
+        }
 
         /**
-         * @brief Get the increment value (how much the counter is incremented per tick)
+         * @brief Set the output depth (see LFOScaling)
          * 
-         * @return uint32_t The oscillators 24 bit increment value
+         * @param depth The depth, LFOScaling::FullDepth (65536) for full scale output
          */
-        uint32_t getIncrementValue() const { return tick_increment; };
+        void setDepth(uint32_t depth){ scaling.setDepth(depth); }
 
         /**
-         * @brief Sets the oscillators internal counter to the supplied value
+         * @brief Set the output offset (see LFOScaling)
          * 
-         * @param value The new 24 bit counter value
+         * @param offset The lowest output value (unipolar) or centre output value (bipolar)
          */
-        void setCounter(uint32_t value){ counter = value % CountsPerPeriod; };
+        void setOffset(uint32_t offset){ scaling.setOffset(offset); }
 
         /**
-         * @brief Check if the internal counter is more than half way
+         * @brief Set whether the depth scales towards 0 or towards the centre of the wave
          * 
-         * @return true If counter its more than halfway (wave output is positive)
-         * @return false If not (wave output is negative)
+         * @param polarity The polarity (the offset is kept)
          */
-        bool isHalfway() const { return (( counter > (CountsPerPeriod / 2) ) ? true : false); };
+        void setPolarity(LFOPolarity polarity){ scaling.setPolarity(polarity); }
 
-    protected:
-        /**
-         * @brief The amount the oscillator is incremented per tick
-         */
-        uint32_t tick_increment;
+        uint32_t getDepth() const { return scaling.getDepth(); }                //!< Get the output depth
+        uint32_t getOffset() const { return scaling.getOffset(); }              //!< Get the output offset
+        LFOPolarity getPolarity() const { return scaling.getPolarity(); }       //!< Get the output polarity
 
+    protected:
         /**
-         * @brief The internal 24 bit counter
+         * @brief The depth and offset applied to every output value
          */
-        uint32_t counter;
+        LFOScaling scaling;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,167 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file BasicSineLFO.h 
+//!  @brief BasicSineLFO class definition
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#ifndef _BASIC_SINE_LFO_H_
+#define _BASIC_SINE_LFO_H_
+
+#include "BaseLFO.h"
+
+/**
+ * @brief Template base class for sine wave Software LFO's
+ * 
+ *  This class provides sine output read from the sine table 
+ *  of the supplied waveform class
+ * 
+ * @tparam WAVEFORMS - The waveform table class (EightBitWaveforms, EightBitQuarterSine, WaveformTables, etc.)
+ * @tparam INTERPOLATION - The interpolation policy (TruncatingInterpolation, LinearInterpolation or HermiteInterpolation)
+ */
+template <class WAVEFORMS, class INTERPOLATION = LinearInterpolation>
+class BasicSineLFO: public BaseLFO
+{
+    public:
+        /**
+         * @brief Get the oscillators output value
+         * 
+         * @return uint32_t The oscillators 24 bit output 
+         */
+        uint32_t getValue() const
+        {
+            return scaling.apply(INTERPOLATION::template interpolate<WAVEFORMS>(WAVEFORMS::getTable(LFOWaveform::Sine), counter));
+        }
+
+        /**
+         * @brief Render a block of output values
+         * 
+         * @param out Buffer receiving the 24 bit output values
+         * @param n The number of values to render
+         */
+        void render(uint32_t *out, size_t n)
+        {
+            this->template renderTable<WAVEFORMS, INTERPOLATION>(WAVEFORMS::getTable(LFOWaveform::Sine), scaling, out, n);
+        }
+
+        /**
+         * @brief Tick the oscillator and render a block of output values
+         * 
+         * @param out Buffer receiving the 24 bit output values
+         * @param n The number of values to render
+         */
+        void tickAndRender(uint32_t *out, size_t n)
+        {
+            this->template tickAndRenderTable<WAVEFORMS, INTERPOLATION>(WAVEFORMS::getTable(LFOWaveform::Sine), scaling, out, n);
+        }
+
+        /**
+         * @brief Render a block of output samples in a DAC/PWM format (see render())
+         * 
+         * @tparam FORMAT The output format (such as LFOOutput10Bit or LFOOutputSigned16Bit)
+         * @param out Buffer receiving the output samples
+         * @param n The number of samples to render
+         */
+        template <class FORMAT>
+        void renderOutput(typename FORMAT::Sample *out, size_t n)
+        {
+            LFONoDither dither;
+            renderOutput<FORMAT>(out, n, dither);
+        }
+
+        /**
+         * @brief Render a block of dithered output samples in a DAC/PWM format (see render())
+         * 
+         * @tparam FORMAT The output format (such as LFOOutput10Bit or LFOOutputSigned16Bit)
+         * @tparam DITHER The dither class (LFONoDither, LFOTPDFDither or LFONoiseShapedDither)
+         * @param out Buffer receiving the output samples
+         * @param n The number of samples to render
+         * @param dither The dither state (keep one per output)
+         */
+        template <class FORMAT, class DITHER>
+        void renderOutput(typename FORMAT::Sample *out, size_t n, DITHER &dither)
+        {
+            this->template renderTableOutput<WAVEFORMS, INTERPOLATION, FORMAT>(WAVEFORMS::getTable(LFOWaveform::Sine), scaling, out, n, dither);
+        }
+
+        /**
+         * @brief Tick and render a block of output samples in a DAC/PWM format (see tickAndRender())
+         * 
+         * @tparam FORMAT The output format (such as LFOOutput10Bit or LFOOutputSigned16Bit)
+         * @param out Buffer receiving the output samples
+         * @param n The number of samples to render
+         */
+        template <class FORMAT>
+        void tickAndRenderOutput(typename FORMAT::Sample *out, size_t n)
+        {
+            LFONoDither dither;
+            tickAndRenderOutput<FORMAT>(out, n, dither);
+        }
+
+        /**
+         * @brief Tick and render a block of dithered output samples in a DAC/PWM format (see tickAndRender())
+         * 
+         * @tparam FORMAT The output format (such as LFOOutput10Bit or LFOOutputSigned16Bit)
+         * @tparam DITHER The dither class (LFONoDither, LFOTPDFDither or LFONoiseShapedDither)
+         * @param out Buffer receiving the output samples
+         * @param n The number of samples to render
+         * @param dither The dither state (keep one per output)
+         */
+        template <class FORMAT, class DITHER>
+        void tickAndRenderOutput(typename FORMAT::Sample *out, size_t n, DITHER &dither)
+        {
+            this->template tickAndRenderTableOutput<WAVEFORMS, INTERPOLATION, FORMAT>(WAVEFORMS::getTable(LFOWaveform::Sine), scaling, out, n, dither);
+        }
+};
+
+#endif
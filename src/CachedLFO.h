@@ -0,0 +1,226 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file CachedLFO.h 
+//!  @brief CachedLFO class definition
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#ifndef _CACHED_LFO_H_
+#define _CACHED_LFO_H_
+
+#include "LFOScaling.h"
+#include "Waveforms/EightBitWaveforms.h"
+
+/**
+ * @brief When a CachedLFO calculates its output value
+ */
+enum class LFOCacheMode
+{
+    Lazy = 0,   //!< The first getValue() after a tick calculates the value, later calls return it
+    Eager       //!< tick() calculates the value, getValue() only returns it
+};
+
+/**
+ * @brief Software LFO which calculates its output once per tick for several readers
+ * 
+ * Without caching every getValue() call repeats the table lookups, interpolation 
+ * and scaling.  When several consumers read the same LFO between ticks (for 
+ * example a PWM output, a display and a modulation target), CachedLFO calculates 
+ * the value once and returns the stored value to the other readers.  
+ * 
+ * In Lazy mode tick() only marks the value as out of date, so ticks which are 
+ * never read cost nothing extra.  In Eager mode tick() calculates the value, so 
+ * every getValue() is a single load (useful when the value is read from an 
+ * interrupt that must be short).  
+ * 
+ * Every function that changes the output (tick(), advance(), setPhase(), 
+ * setWaveform(), setDepth(), ...) is replaced with one that also updates the 
+ * cache, so they must be called on the CachedLFO itself rather than through a 
+ * BaseLFO pointer.  getValue() is virtual and may be called through either.
+ * 
+ *     CachedLFO<DeluxeSoftwareLFO<1>> LFO;
+ *     LFO.tick();
+ *     analogWrite(OUTPUT_PIN, LFO.getValue() >> 16); //Calculated here
+ *     display(LFO.getValue());                       //Stored value
+ * 
+ * @tparam LFO - The LFO class (SoftwareLFO, DeluxeSoftwareLFO or a variant)
+ * @tparam MODE - When the output value is calculated (LFOCacheMode::Lazy or LFOCacheMode::Eager)
+ */
+template <class LFO, LFOCacheMode MODE = LFOCacheMode::Lazy>
+class CachedLFO: public LFO
+{
+    public:
+        /**
+         * @brief Construct a new CachedLFO object
+         */
+        CachedLFO(): value(0), valid(false)
+        {
+            refresh();
+        }
+
+        /**
+         * @brief Get the oscillators output value (calculated at most once per tick)
+         * 
+         * @return uint32_t The oscillators 24 bit output
+         */
+        uint32_t getValue() const
+        {
+            if (MODE == LFOCacheMode::Lazy && !valid)
+            {
+                value = LFO::getValue();
+                valid = true;
+            }
+            return value;
+        }
+
+        inline void tick()
+        {
+            LFO::tick();
+            refresh();
+        }
+
+        inline void advance(uint32_t ticks)
+        {
+            LFO::advance(ticks);
+            refresh();
+        }
+
+        void render(uint32_t *out, size_t n)
+        {
+            LFO::render(out, n);
+            refresh();
+        }
+
+        void tickAndRender(uint32_t *out, size_t n)
+        {
+            LFO::tickAndRender(out, n);
+            refresh();
+        }
+
+        template <class FORMAT, class... DITHER>
+        void renderOutput(typename FORMAT::Sample *out, size_t n, DITHER &... dither)
+        {
+            LFO::template renderOutput<FORMAT>(out, n, dither...);
+            refresh();
+        }
+
+        template <class FORMAT, class... DITHER>
+        void tickAndRenderOutput(typename FORMAT::Sample *out, size_t n, DITHER &... dither)
+        {
+            LFO::template tickAndRenderOutput<FORMAT>(out, n, dither...);
+            refresh();
+        }
+
+        inline void reset()
+        {
+            LFO::reset();
+            refresh();
+        }
+
+        void setCounter(uint32_t counterValue)
+        {
+            LFO::setCounter(counterValue);
+            refresh();
+        }
+
+        void setPhase(uint32_t phase)
+        {
+            LFO::setPhase(phase);
+            refresh();
+        }
+
+        void setPhaseFromTime(uint64_t epochTicks, uint32_t phaseAtEpoch = 0)
+        {
+            LFO::setPhaseFromTime(epochTicks, phaseAtEpoch);
+            refresh();
+        }
+
+        void setWaveform(LFOWaveform waveform)
+        {
+            LFO::setWaveform(waveform);
+            refresh();
+        }
+
+        void setDepth(uint32_t depth)
+        {
+            LFO::setDepth(depth);
+            refresh();
+        }
+
+        void setOffset(uint32_t offset)
+        {
+            LFO::setOffset(offset);
+            refresh();
+        }
+
+        void setPolarity(LFOPolarity polarity)
+        {
+            LFO::setPolarity(polarity);
+            refresh();
+        }
+
+    protected:
+        /**
+         * @brief Mark the stored value out of date (Lazy) or recalculate it (Eager)
+         */
+        inline void refresh()
+        {
+            if (MODE == LFOCacheMode::Eager) value = LFO::getValue();
+            else valid = false;
+        }
+
+        mutable uint32_t value;     //!< The stored output value
+        mutable bool valid;         //!< Whether value is up to date (Lazy mode only)
+};
+
+#endif
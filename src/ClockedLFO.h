@@ -0,0 +1,174 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file ClockedLFO.h 
+//!  @brief ClockedLFO class definition
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#ifndef _CLOCKED_LFO_H_
+#define _CLOCKED_LFO_H_
+
+#include <Arduino.h>
+#include "LFOCounter.h"
+#include "LFOCalculator.h"
+
+/**
+ * @brief Software LFO which runs from a millisecond clock instead of tick()
+ * 
+ * update(millis()) advances the wrapped LFO by every tick that has elapsed 
+ * since the previous update, in constant time through its own advance(), so 
+ * a late loop costs the same as an on-time one and wrappers inside this one 
+ * (AtomicLFO, CachedLFO, GlidingLFO, ExtendedPrecisionLFO) keep working.  
+ * Ticks that are not yet complete carry over to the next call, so the phase 
+ * follows the clock exactly no matter how late or irregular the calls are.  
+ * The elapsed ticks are calculated with 32 bit operations only on 8 and 32 
+ * bit processors (see LFOIncrementMath::multiplyDivide()).
+ * 
+ * LFOs that are only ticked do not carry the clock state.
+ * 
+ *     ClockedLFO<DeluxeSoftwareLFO<1>> LFO;
+ *     //In loop():
+ *     LFO.update(millis());
+ * 
+ * @tparam LFO - The LFO class (SoftwareLFO, DeluxeSoftwareLFO or a variant)
+ */
+template <class LFO>
+class ClockedLFO: public LFO
+{
+    public:
+        /**
+         * @brief Construct a new ClockedLFO object (update() counts time from 0 ms)
+         */
+        ClockedLFO(): update_ms(0), update_ticks(0){}
+
+        /**
+         * @brief Run the oscillator up to the supplied time
+         * 
+         * Call this instead of tick(), for example update(millis()) from loop().  
+         * The time may wrap around, but update() must be called at least once every 
+         * 2^32 / TicksPerMsNumerator milliseconds.
+         * 
+         * @param nowMs The current time in milliseconds
+         */
+        inline void update(uint32_t nowMs)
+        {
+            LFO::advance(takeElapsedTicks(nowMs));
+        }
+
+        /**
+         * @brief Set the time from which update() counts ticks, without advancing the oscillator
+         * 
+         * @param nowMs The current time in milliseconds
+         */
+        inline void setUpdateTime(uint32_t nowMs)
+        {
+            update_ms = nowMs;
+            update_ticks = 0;
+        }
+
+        /**
+         * @brief Change the tick period of a RuntimeSoftwareLFO
+         * 
+         *  update() carries on from the time already counted (to within a fraction of a tick).
+         * 
+         * @param tickNumerator Numerator of the tick period in seconds
+         * @param tickDenominator Denominator of the tick period in seconds
+         */
+        void setTickPeriod(uint32_t tickNumerator, uint32_t tickDenominator)
+        {
+            //Move the time origin up to the ticks already applied
+            update_ms += Math::multiplyDivide(update_ticks, this->getTicksPerMsDenominator(), this->getTicksPerMsNumerator());
+            update_ticks = 0;
+            LFO::setTickPeriod(tickNumerator, tickDenominator);
+        }
+
+        inline void setTickRateMs(uint32_t tickRateMs) { setTickPeriod(tickRateMs, 1000); }
+        inline void setTickRateUs(uint32_t tickRateUs) { setTickPeriod(tickRateUs, 1000000UL); }
+        inline void setTickRateHz(uint32_t ticksPerSecond) { setTickPeriod(1, ticksPerSecond); }
+
+    protected:
+        typedef LFOIncrementMath<LFOCounter::PhaseBitDepth> Math;
+
+        /**
+         * @brief Get the number of ticks elapsed since the last update() and count them as applied
+         * 
+         * @param nowMs The current time in milliseconds
+         * @return uint32_t The number of ticks to advance
+         */
+        inline uint32_t takeElapsedTicks(uint32_t nowMs)
+        {
+            const uint32_t num = this->getTicksPerMsNumerator();
+            const uint32_t den = this->getTicksPerMsDenominator();
+            uint32_t elapsed = nowMs - update_ms;
+            uint32_t ticks = (den == 1) ? elapsed * num : ((num == 1) ? elapsed / den : Math::multiplyDivide(elapsed, num, den));
+            uint32_t pending = ticks - update_ticks;
+            update_ticks = ticks;
+            //Move the time origin forward by whole multiples of the ratio, keeping the division exact
+            uint32_t whole = elapsed / den;
+            update_ms += whole * den;
+            update_ticks -= whole * num;
+            return pending;
+        }
+
+        /**
+         * @brief Time origin of update() in milliseconds
+         */
+        uint32_t update_ms;
+
+        /**
+         * @brief Ticks already applied since update_ms
+         */
+        uint32_t update_ticks;
+};
+
+#endif
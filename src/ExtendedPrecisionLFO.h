@@ -0,0 +1,371 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file ExtendedPrecisionLFO.h 
+//!  @brief ExtendedPrecisionLFO class definition (64 bit phase accumulator)
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef _EXTENDED_PRECISION_LFO_H_
+#define _EXTENDED_PRECISION_LFO_H_
+
+#include <Arduino.h>
+#include "LFOOutputFormat.h"
+
+/**
+ * @brief Software LFO with a 64 bit phase accumulator for very slow frequencies
+ * 
+ * The 32 bit phase increment of a slow LFO at a fast tick rate is a small 
+ * number, so its frequency can only be set in coarse steps (a 3 hour period 
+ * at 1 ms ticks is an increment of about 398, so each step is 0.25%).  This 
+ * class adds 32 fraction bits below the phase and below the increment, 
+ * making the increment a 64 bit value.  Hours or days long periods are 
+ * then set to within a fraction of a part per billion.
+ * 
+ * tick() adds the fraction increment and carries into the phase, which is 
+ * a few more instructions than the plain 32 bit tick().  The outputs are 
+ * read from the upper 32 bits, so getValue() costs the same.
+ * 
+ * setFrequencyMilliHz() and setPeriodMs() calculate the 64 bit increment 
+ * from the tick period with integer math only.  setFrequency() and 
+ * setPeriod() use floating point, with the same relative precision as a float.
+ * Other ways of setting the frequency (setPhaseIncrement() and setFrequencyExp()) 
+ * set the 32 bit increment and clear the fraction.  After 
+ * changing the tick rate of a RuntimeSoftwareLFO set the frequency again.
+ * 
+ * Like CachedLFO, the replaced functions must be called on the 
+ * ExtendedPrecisionLFO itself rather than through a BaseLFO pointer.
+ * 
+ *     ExtendedPrecisionLFO<SoftwareLFO<1>> LFO;
+ *     LFO.setPeriodMs(3UL * 60 * 60 * 1000); //Exactly 3 hours
+ * 
+ * @tparam LFO - The LFO class (SoftwareLFO, DeluxeSoftwareLFO or a variant)
+ */
+template <class LFO>
+class ExtendedPrecisionLFO: public LFO
+{
+    public:
+        /**
+         * @brief Construct a new ExtendedPrecisionLFO object
+         */
+        ExtendedPrecisionLFO(): fraction(0), fraction_increment(0){}
+
+        /**
+         * @brief Set the 64 bit phase increment value
+         * 
+         * @param value The new value (a full period is 2^64)
+         */
+        inline void setPhaseIncrement64(uint64_t value)
+        {
+            LFO::setPhaseIncrement(static_cast<uint32_t>(value >> 32));
+            fraction_increment = static_cast<uint32_t>(value);
+        }
+
+        /**
+         * @brief Get the 64 bit phase increment value
+         * 
+         * @return uint64_t The oscillators 64 bit phase increment value
+         */
+        inline uint64_t getPhaseIncrement64() const
+        {
+            return (static_cast<uint64_t>(this->tick_increment) << 32) | fraction_increment;
+        }
+
+        /**
+         * @brief Set the 64 bit phase
+         * 
+         * @param value The new phase (the upper 32 bits are getPhase())
+         */
+        inline void setPhase64(uint64_t value)
+        {
+            LFO::setPhase(static_cast<uint32_t>(value >> 32));
+            fraction = static_cast<uint32_t>(value);
+        }
+
+        /**
+         * @brief Get the 64 bit phase
+         * 
+         * @return uint64_t The oscillators 64 bit phase accumulator value
+         */
+        inline uint64_t getPhase64() const
+        {
+            return (static_cast<uint64_t>(this->counter) << 32) | fraction;
+        }
+
+        /**
+         * @brief Set the frequency from millihertz, to 64 bit precision (integer only)
+         * 
+         * @param freqMilliHertz The desired frequency in millihertz
+         */
+        void setFrequencyMilliHz(uint32_t freqMilliHertz)
+        {
+            setPhaseIncrement64(incrementForRatio(static_cast<uint64_t>(freqMilliHertz) * this->getTickNumerator(), 
+                                                  1000ULL * this->getTickDenominator()));
+        }
+
+        /**
+         * @brief Set the period in milliseconds, to 64 bit precision (integer only)
+         * 
+         * @param periodMilliseconds The desired period in milliseconds
+         */
+        void setPeriodMs(uint32_t periodMilliseconds)
+        {
+            setPhaseIncrement64(incrementForRatio(1000ULL * this->getTickNumerator(), 
+                                                  static_cast<uint64_t>(periodMilliseconds) * this->getTickDenominator()));
+        }
+
+        /**
+         * @brief Set the frequency (float precision, without the 32 bit increment quantization)
+         * 
+         * @param freqHertz The desired frequency
+         */
+        void setFrequency(float freqHertz)
+        {
+            //Increment in units of 2^-32 of the 32 bit phase increment
+            float increment = freqHertz * 4294967296.f * static_cast<float>(this->getTickNumerator()) / 
+                              static_cast<float>(this->getTickDenominator());
+            if (!(increment >= 1.f)) setPhaseIncrement64(1);
+            else if (increment >= 2147483648.f) setPhaseIncrement64(1ULL << 63);
+            else setPhaseIncrement64(static_cast<uint64_t>(increment * 4294967296.f));
+        }
+
+        /**
+         * @brief Set the period (float precision, see setFrequency())
+         * 
+         * @param periodSeconds The desired period in seconds
+         */
+        void setPeriod(float periodSeconds)
+        {
+            setFrequency(1.f / periodSeconds);
+        }
+
+        inline void setPhaseIncrement(uint32_t value)
+        {
+            fraction_increment = 0;
+            LFO::setPhaseIncrement(value);
+        }
+
+        inline void setIncrementValue(uint32_t value)
+        {
+            fraction_increment = 0;
+            LFO::setIncrementValue(value);
+        }
+
+        inline void setFrequencyExp(int32_t octaves)
+        {
+            fraction_increment = 0;
+            LFO::setFrequencyExp(octaves);
+        }
+
+        /**
+         * @brief Increment the oscillator, carrying the fraction into the phase
+         */
+        inline void tick()
+        {
+            fraction += fraction_increment;
+            uint32_t carry = (fraction < fraction_increment) ? 1 : 0;
+            LFO::tick();
+            this->counter += carry;
+        }
+
+        /**
+         * @brief Advance the oscillator by several ticks at once (see BaseLFO::advance())
+         * 
+         * @param ticks The number of ticks to advance
+         */
+        inline void advance(uint32_t ticks)
+        {
+            uint64_t sum = static_cast<uint64_t>(ticks) * fraction_increment + fraction;
+            fraction = static_cast<uint32_t>(sum);
+            LFO::advance(ticks);
+            this->counter += static_cast<uint32_t>(sum >> 32);
+        }
+
+        inline void reset()
+        {
+            fraction = 0;
+            LFO::reset();
+        }
+
+        void setCounter(uint32_t counterValue)
+        {
+            fraction = 0;
+            LFO::setCounter(counterValue);
+        }
+
+        void setPhase(uint32_t phase)
+        {
+            fraction = 0;
+            LFO::setPhase(phase);
+        }
+
+        /**
+         * @brief Set the 64 bit phase from a shared time base (see LFOCounter::setPhaseFromTime())
+         * 
+         * @param epochTicks The number of ticks since the shared epoch
+         * @param phaseAtEpoch The 32 bit phase at the epoch
+         */
+        void setPhaseFromTime(uint64_t epochTicks, uint32_t phaseAtEpoch = 0)
+        {
+            setPhase64((static_cast<uint64_t>(phaseAtEpoch) << 32) + epochTicks * getPhaseIncrement64());
+        }
+
+        void render(uint32_t *out, size_t n)
+        {
+            if (fraction_increment == 0)
+            {
+                LFO::render(out, n);
+                return;
+            }
+            for (size_t s = 0; s < n; s++)
+            {
+                out[s] = LFO::getValue();
+                tick();
+            }
+        }
+
+        void tickAndRender(uint32_t *out, size_t n)
+        {
+            if (fraction_increment == 0)
+            {
+                LFO::tickAndRender(out, n);
+                return;
+            }
+            for (size_t s = 0; s < n; s++)
+            {
+                tick();
+                out[s] = LFO::getValue();
+            }
+        }
+
+        template <class FORMAT, class... DITHER>
+        void renderOutput(typename FORMAT::Sample *out, size_t n, DITHER &... dither)
+        {
+            if (fraction_increment == 0)
+            {
+                LFO::template renderOutput<FORMAT>(out, n, dither...);
+                return;
+            }
+            for (size_t s = 0; s < n; s++)
+            {
+                out[s] = fractionOutput<FORMAT>(dither...);
+                tick();
+            }
+        }
+
+        template <class FORMAT, class... DITHER>
+        void tickAndRenderOutput(typename FORMAT::Sample *out, size_t n, DITHER &... dither)
+        {
+            if (fraction_increment == 0)
+            {
+                LFO::template tickAndRenderOutput<FORMAT>(out, n, dither...);
+                return;
+            }
+            for (size_t s = 0; s < n; s++)
+            {
+                tick();
+                out[s] = fractionOutput<FORMAT>(dither...);
+            }
+        }
+
+    protected:
+        template <class FORMAT>
+        inline typename FORMAT::Sample fractionOutput() const
+        {
+            LFONoDither dither;
+            return fractionOutput<FORMAT>(dither);
+        }
+
+        /**
+         * @brief Get the output sample of the wrapped LFO (not through the virtual getValue(), which a CachedLFO around this one would answer from its stale cache)
+         */
+        template <class FORMAT, class DITHER>
+        inline typename FORMAT::Sample fractionOutput(DITHER &dither) const
+        {
+            return FORMAT::convert(dither.template quantize<FORMAT>(LFO::getValue()));
+        }
+
+        /**
+         * @brief Calculate the 64 bit increment 2^64 * num / den, limited to half the tick rate
+         * 
+         *  Uses a shift and subtract division, so no 128 bit math is needed.
+         */
+        static uint64_t incrementForRatio(uint64_t num, uint64_t den)
+        {
+            //Keep the remainder from overflowing when it is doubled
+            while (den >= (1ULL << 63))
+            {
+                num >>= 1;
+                den >>= 1;
+            }
+            if ((den == 0) || (num >= den / 2)) return 1ULL << 63;
+            uint64_t quotient = 0;
+            uint64_t remainder = num;
+            for (unsigned int bit = 0; bit < 64; bit++)
+            {
+                remainder <<= 1;
+                quotient <<= 1;
+                if (remainder >= den)
+                {
+                    remainder -= den;
+                    quotient |= 1;
+                }
+            }
+            return (quotient == 0) ? 1 : quotient;
+        }
+
+        uint32_t fraction;              //!< The lower 32 bits of the 64 bit phase
+        uint32_t fraction_increment;    //!< The lower 32 bits of the 64 bit phase increment
+};
+
+#endif
@@ -0,0 +1,312 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file GlidingLFO.h 
+//!  @brief GlidingLFO class definition
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#ifndef _GLIDING_LFO_H_
+#define _GLIDING_LFO_H_
+
+#include <Arduino.h>
+#include "LFOGlide.h"
+#include "LFOOutputFormat.h"
+
+/**
+ * @brief Software LFO which can glide (portamento) from one frequency to another
+ * 
+ * The phase increment is ramped by a precomputed integer step on every tick 
+ * (see LFOGlide), so no floating point work is done until the next glide.  
+ * Setting the frequency directly stops a running glide, and changing the tick 
+ * rate of a RuntimeSoftwareLFO jumps to its target.
+ * 
+ * LFOs that never glide do not carry the glide state or pay for the extra 
+ * branch in tick().  Like CachedLFO, the replaced functions must be called on 
+ * the GlidingLFO itself rather than through a BaseLFO pointer.
+ * 
+ *     GlidingLFO<DeluxeSoftwareLFO<1>> LFO;
+ *     LFO.setFrequency(1.0f);
+ *     LFO.glideToFrequency(5.0f, 2000, LFOGlideShape::Exponential); //Reach 5 Hz in 2 seconds
+ * 
+ * @tparam LFO - The LFO class (SoftwareLFO, DeluxeSoftwareLFO or a variant)
+ */
+template <class LFO>
+class GlidingLFO: public LFO
+{
+    public:
+        /**
+         * @brief Glide from the current frequency to a new one
+         * 
+         * @param freqHertz The target frequency
+         * @param timeMs The length of the glide in milliseconds
+         * @param shape LFOGlideShape::Linear or LFOGlideShape::Exponential
+         */
+        inline void glideToFrequency(float freqHertz, uint32_t timeMs, LFOGlideShape shape = LFOGlideShape::Linear)
+        {
+            glideToPhaseIncrement(this->getIncrementValueForFrequency(freqHertz), timeMs, shape);
+        }
+
+        /**
+         * @brief Glide from the current frequency to a new one (integer only)
+         * 
+         * @param freqMilliHertz The target frequency in millihertz
+         * @param timeMs The length of the glide in milliseconds
+         * @param shape LFOGlideShape::Linear or LFOGlideShape::Exponential
+         */
+        inline void glideToFrequencyMilliHz(uint32_t freqMilliHertz, uint32_t timeMs, LFOGlideShape shape = LFOGlideShape::Linear)
+        {
+            glideToPhaseIncrement(this->getIncrementValueForFrequencyMilliHz(freqMilliHertz), timeMs, shape);
+        }
+
+        /**
+         * @brief Glide from the current phase increment to a new one
+         * 
+         * @param phaseIncrement The target 32 bit phase increment
+         * @param timeMs The length of the glide in milliseconds
+         * @param shape LFOGlideShape::Linear or LFOGlideShape::Exponential
+         */
+        void glideToPhaseIncrement(uint32_t phaseIncrement, uint32_t timeMs, LFOGlideShape shape = LFOGlideShape::Linear)
+        {
+            const uint32_t num = this->getTicksPerMsNumerator();
+            const uint32_t den = this->getTicksPerMsDenominator();
+            uint32_t ticks = static_cast<uint32_t>((static_cast<uint64_t>(timeMs) * num) / den);
+            LFO::setPhaseIncrement(glide.start(this->tick_increment, phaseIncrement, ticks, shape));
+        }
+
+        /**
+         * @brief Check if a glide is running
+         * 
+         * @return true If the frequency is still changing
+         */
+        bool isGliding() const { return glide.isActive(); }
+
+        inline void setPhaseIncrement(uint32_t value)
+        {
+            glide.stop();
+            LFO::setPhaseIncrement(value);
+        }
+
+        inline void setIncrementValue(uint32_t value)
+        {
+            glide.stop();
+            LFO::setIncrementValue(value);
+        }
+
+        inline void setPeriod(float periodSeconds)
+        {
+            glide.stop();
+            LFO::setPeriod(periodSeconds);
+        }
+
+        inline void setFrequency(float freqHertz)
+        {
+            glide.stop();
+            LFO::setFrequency(freqHertz);
+        }
+
+        inline void setPeriodMs(uint32_t periodMilliseconds)
+        {
+            glide.stop();
+            LFO::setPeriodMs(periodMilliseconds);
+        }
+
+        inline void setFrequencyMilliHz(uint32_t freqMilliHertz)
+        {
+            glide.stop();
+            LFO::setFrequencyMilliHz(freqMilliHertz);
+        }
+
+        inline void setFrequencyExp(int32_t octaves)
+        {
+            glide.stop();
+            LFO::setFrequencyExp(octaves);
+        }
+
+        /**
+         * @brief Change the tick period of a RuntimeSoftwareLFO, jumping to the target of a running glide
+         * 
+         * @param tickNumerator Numerator of the tick period in seconds
+         * @param tickDenominator Denominator of the tick period in seconds
+         */
+        void setTickPeriod(uint32_t tickNumerator, uint32_t tickDenominator)
+        {
+            if (glide.isActive())
+            {
+                LFO::setPhaseIncrement(glide.getTarget());
+                glide.stop();
+            }
+            LFO::setTickPeriod(tickNumerator, tickDenominator);
+        }
+
+        inline void setTickRateMs(uint32_t tickRateMs) { setTickPeriod(tickRateMs, 1000); }
+        inline void setTickRateUs(uint32_t tickRateUs) { setTickPeriod(tickRateUs, 1000000UL); }
+        inline void setTickRateHz(uint32_t ticksPerSecond) { setTickPeriod(1, ticksPerSecond); }
+
+        /**
+         * @brief Increment the oscillator, moving along any running glide
+         */
+        inline void tick()
+        {
+            LFO::tick();
+            glide.tick(this->tick_increment);
+        }
+
+        /**
+         * @brief Advance the oscillator by several ticks at once, following any running glide exactly
+         * 
+         *  The phase change of the glide is split into two runs of constant increment 
+         *  (q + 1 for r ticks and q for the rest), which the wrapped LFO's own advance() 
+         *  applies, so a CachedLFO or ExtendedPrecisionLFO inside stays up to date.
+         * 
+         * @param ticks The number of ticks to advance
+         */
+        inline void advance(uint32_t ticks)
+        {
+            if (!glide.isActive() || (ticks == 0))
+            {
+                LFO::advance(ticks);
+                return;
+            }
+            uint32_t increment = this->tick_increment;
+            uint32_t phase = glide.advance(increment, ticks);
+            uint32_t quotient = phase / ticks;
+            uint32_t remainder = phase % ticks;
+            if (remainder)
+            {
+                LFO::setPhaseIncrement(quotient + 1);
+                LFO::advance(remainder);
+            }
+            LFO::setPhaseIncrement(quotient);
+            LFO::advance(ticks - remainder);
+            LFO::setPhaseIncrement(increment);
+        }
+
+        void render(uint32_t *out, size_t n)
+        {
+            if (!glide.isActive())
+            {
+                LFO::render(out, n);
+                return;
+            }
+            for (size_t s = 0; s < n; s++)
+            {
+                out[s] = LFO::getValue();
+                tick();
+            }
+        }
+
+        void tickAndRender(uint32_t *out, size_t n)
+        {
+            if (!glide.isActive())
+            {
+                LFO::tickAndRender(out, n);
+                return;
+            }
+            for (size_t s = 0; s < n; s++)
+            {
+                tick();
+                out[s] = LFO::getValue();
+            }
+        }
+
+        template <class FORMAT, class... DITHER>
+        void renderOutput(typename FORMAT::Sample *out, size_t n, DITHER &... dither)
+        {
+            if (!glide.isActive())
+            {
+                LFO::template renderOutput<FORMAT>(out, n, dither...);
+                return;
+            }
+            for (size_t s = 0; s < n; s++)
+            {
+                out[s] = glideOutput<FORMAT>(dither...);
+                tick();
+            }
+        }
+
+        template <class FORMAT, class... DITHER>
+        void tickAndRenderOutput(typename FORMAT::Sample *out, size_t n, DITHER &... dither)
+        {
+            if (!glide.isActive())
+            {
+                LFO::template tickAndRenderOutput<FORMAT>(out, n, dither...);
+                return;
+            }
+            for (size_t s = 0; s < n; s++)
+            {
+                tick();
+                out[s] = glideOutput<FORMAT>(dither...);
+            }
+        }
+
+    protected:
+        template <class FORMAT>
+        inline typename FORMAT::Sample glideOutput() const
+        {
+            LFONoDither dither;
+            return glideOutput<FORMAT>(dither);
+        }
+
+        /**
+         * @brief Get the output sample of the wrapped LFO (not through the virtual getValue(), which a CachedLFO around this one would answer from its stale cache)
+         */
+        template <class FORMAT, class DITHER>
+        inline typename FORMAT::Sample glideOutput(DITHER &dither) const
+        {
+            return FORMAT::convert(dither.template quantize<FORMAT>(LFO::getValue()));
+        }
+
+        LFOGlide glide;     //!< The running frequency glide
+};
+
+#endif
@@ -0,0 +1,169 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file LFOAtomic.h 
+//!  @brief Shared variables for data exchanged with interrupts or threads
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#ifndef _LFO_ATOMIC_H_
+#define _LFO_ATOMIC_H_
+
+#include <Arduino.h>
+
+#ifndef ARDUINO
+#include <atomic>
+#endif
+
+/**
+ * @brief A variable shared between an interrupt (or thread) and the main program
+ * 
+ * On Arduino targets (single core) this is a volatile variable and the fences
+ * are compiler barriers.  On the host build it is a std::atomic, so the same
+ * code is also correct between threads.  Only types which the target can 
+ * load and store in a single instruction are read without tearing (uint8_t 
+ * on AVR), larger values must be protected, for example with a sequence 
+ * counter as in LFOScheduler.
+ * 
+ * @tparam T - The type of the variable
+ */
+template <typename T>
+class LFOShared
+{
+    public:
+        /**
+         * @brief Construct a new LFOShared object
+         * 
+         * @param initial The initial value
+         */
+        LFOShared(T initial = T()): value(initial){}
+
+        LFOShared(const LFOShared &) = delete;
+        LFOShared &operator=(const LFOShared &) = delete;
+
+#ifdef ARDUINO
+        inline T load() const { return value; }                     //!< Read the value (no ordering)
+        inline T loadAcquire() const { return value; }              //!< Read the value before any later reads
+        inline void store(T v) { value = v; }                       //!< Write the value (no ordering)
+        inline void storeRelease(T v) { value = v; }                //!< Write the value after any earlier writes
+
+        /**
+         * @brief Replace the value if it equals expected (only atomic between the main program and an interrupt 
+         *        when called from a single context)
+         * 
+         * @param expected The expected value, updated to the current value on failure
+         * @param desired The new value
+         * @return true The value was replaced
+         */
+        inline bool compareExchange(T &expected, T desired)
+        {
+            T current = value;
+            if (current != expected)
+            {
+                expected = current;
+                return false;
+            }
+            value = desired;
+            return true;
+        }
+    private:
+        volatile T value;
+#else
+        inline T load() const { return value.load(std::memory_order_relaxed); }             //!< Read the value (no ordering)
+        inline T loadAcquire() const { return value.load(std::memory_order_acquire); }      //!< Read the value before any later reads
+        inline void store(T v) { value.store(v, std::memory_order_relaxed); }               //!< Write the value (no ordering)
+        inline void storeRelease(T v) { value.store(v, std::memory_order_release); }        //!< Write the value after any earlier writes
+
+        /**
+         * @brief Atomically replace the value if it equals expected
+         * 
+         * @param expected The expected value, updated to the current value on failure
+         * @param desired The new value
+         * @return true The value was replaced
+         */
+        inline bool compareExchange(T &expected, T desired)
+        {
+            return value.compare_exchange_weak(expected, desired, std::memory_order_acquire, std::memory_order_relaxed);
+        }
+    private:
+        std::atomic<T> value;
+#endif
+};
+
+/**
+ * @brief Static class providing memory fences and the sequence counter type
+ */
+class LFOAtomic
+{
+    public:
+        LFOAtomic() = delete; //!< Unconstructable class
+
+#ifdef ARDUINO
+        /**
+         * @brief Type of a sequence counter (a single byte is read atomically on every target)
+         */
+        typedef uint8_t Sequence;
+
+        static inline void acquireFence(){ asm volatile("" : : : "memory"); } //!< Keep earlier reads before later reads
+        static inline void releaseFence(){ asm volatile("" : : : "memory"); } //!< Keep earlier writes before later writes
+#else
+        /**
+         * @brief Type of a sequence counter
+         */
+        typedef uint32_t Sequence;
+
+        static inline void acquireFence(){ std::atomic_thread_fence(std::memory_order_acquire); } //!< Keep earlier reads before later reads
+        static inline void releaseFence(){ std::atomic_thread_fence(std::memory_order_release); } //!< Keep earlier writes before later writes
+#endif
+};
+
+#endif
@@ -0,0 +1,377 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file LFOBank.h 
+//!  @brief LFOBank class definition
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef _LFO_BANK_H_
+#define _LFO_BANK_H_
+
+#include "LFOCounter.h"
+#include "LFOScaling.h"
+#include "LFOCalculator.h"
+#include "Waveforms/EightBitWaveforms.h"
+
+/**
+ * @brief A bank of N LFO's sharing a single tick rate
+ * 
+ *  The counters, increments, waveform selections, depths and bases of every 
+ *  oscillator are stored in contiguous arrays (struct-of-arrays), so tickAll() 
+ *  and renderAll() walk linear memory and can be unrolled/vectorized by the 
+ *  compiler.  While every oscillator is unscaled renderAll() skips the scaling.
+ *  Each oscillator behaves like a DeluxeSoftwareLFO.
+ * 
+ * @tparam N - The number of oscillators in the bank
+ * @tparam TICK_RATE_MS - The tick rate in milliseconds (milliseconds between calls to tickAll())
+ */
+template <size_t N, unsigned long TICK_RATE_MS>
+class LFOBank: public LFOCalculator<TICK_RATE_MS, LFOCounter::PhaseBitDepth>
+{
+    public:
+        /**
+         * @brief Number of oscillators in the bank
+         */
+        static constexpr size_t Size = N;
+
+        /**
+         * @brief Construct a new LFOBank object (all oscillators are stopped sine waves)
+         */
+        LFOBank(): scaled(0)
+        {
+            for (size_t i = 0; i < N; i++)
+            {
+                counters[i] = 0;
+                increments[i] = 0;
+                waveforms[i] = static_cast<uint8_t>(LFOWaveform::Sine);
+                depths[i] = LFOScaling::FullDepth;
+                bases[i] = 0;
+                polarities[i] = LFOPolarity::Unipolar;
+            }
+        }
+
+        /**
+         * @brief Increment every oscillator in the bank
+         * 
+         * This function should be called at a constant rate in order to "run" the oscillators
+         */
+        inline void tickAll()
+        {
+            for (size_t i = 0; i < N; i++)
+            {
+                counters[i] += increments[i];
+            }
+        }
+
+        /**
+         * @brief Advance every oscillator by several ticks at once (see LFOCounter::advance())
+         * 
+         * @param ticks The number of ticks to advance
+         */
+        inline void advanceAll(uint32_t ticks)
+        {
+            for (size_t i = 0; i < N; i++)
+            {
+                counters[i] += ticks * increments[i];
+            }
+        }
+
+        /**
+         * @brief Get the output value of every oscillator in the bank
+         * 
+         * @param out Buffer of at least N values receiving the 24 bit output values
+         */
+        inline void renderAll(uint32_t *out) const
+        {
+            if (scaled == 0)
+            {
+                for (size_t i = 0; i < N; i++)
+                {
+                    out[i] = EightBitWaveforms::interpolate(EightBitWaveforms::tables[waveforms[i]], counters[i]);
+                }
+                return;
+            }
+            for (size_t i = 0; i < N; i++)
+            {
+                out[i] = bases[i] + LFOScaling::scale(EightBitWaveforms::interpolate(EightBitWaveforms::tables[waveforms[i]], counters[i]), depths[i]);
+            }
+        }
+
+        /**
+         * @brief Get the output value of a single oscillator
+         * 
+         * @param index The oscillator index
+         * @return uint32_t The oscillators 24 bit output value
+         */
+        inline uint32_t getValue(size_t index) const
+        {
+            return bases[index] + LFOScaling::scale(EightBitWaveforms::interpolate(EightBitWaveforms::tables[waveforms[index]], counters[index]), depths[index]);
+        }
+
+        /**
+         * @brief Set the frequency of a single oscillator
+         * 
+         * @param index The oscillator index
+         * @param freqHertz The desired frequency
+         */
+        inline void setFrequency(size_t index, float freqHertz)
+        {
+            increments[index] = this->getIncrementValueForFrequency(freqHertz);
+        }
+
+        /**
+         * @brief Set the period of a single oscillator
+         * 
+         * @param index The oscillator index
+         * @param periodSeconds The desired period in seconds
+         */
+        inline void setPeriod(size_t index, float periodSeconds)
+        {
+            increments[index] = this->getIncrementValueForPeriod(periodSeconds);
+        }
+
+        /**
+         * @brief Set the frequency of a single oscillator (integer only)
+         * 
+         * @param index The oscillator index
+         * @param freqMilliHertz The desired frequency in millihertz
+         */
+        inline void setFrequencyMilliHz(size_t index, uint32_t freqMilliHertz)
+        {
+            increments[index] = this->getIncrementValueForFrequencyMilliHz(freqMilliHertz);
+        }
+
+        /**
+         * @brief Set the frequency of a single oscillator on an exponential scale (integer only)
+         * 
+         * @param index The oscillator index
+         * @param octaves The frequency in octaves relative to 1 Hz, with 16 fraction bits (65536 per octave)
+         */
+        inline void setFrequencyExp(size_t index, int32_t octaves)
+        {
+            increments[index] = this->getIncrementValueForOctave(octaves);
+        }
+
+        /**
+         * @brief Set the period of a single oscillator (integer only)
+         * 
+         * @param index The oscillator index
+         * @param periodMilliseconds The desired period in milliseconds
+         */
+        inline void setPeriodMs(size_t index, uint32_t periodMilliseconds)
+        {
+            increments[index] = this->getIncrementValueForPeriodMs(periodMilliseconds);
+        }
+
+        /**
+         * @brief Set the increment value of a single oscillator
+         * 
+         * @param index The oscillator index
+         * @param value The new value (maximum value is CountsPerPeriod)
+         */
+        inline void setIncrementValue(size_t index, uint32_t value)
+        {
+            increments[index] = value << LFOCounter::PhaseShift;
+        }
+
+        /**
+         * @brief Set the waveform of a single oscillator
+         * 
+         * @param index The oscillator index
+         * @param waveform The desired waveform
+         */
+        inline void setWaveform(size_t index, LFOWaveform waveform)
+        {
+            unsigned int w = static_cast<unsigned int>(waveform);
+            if (w >= static_cast<unsigned int>(LFOWaveform::N_WAVEFORMS)) w = static_cast<unsigned int>(LFOWaveform::Sine);
+            waveforms[index] = static_cast<uint8_t>(w);
+        }
+
+        /**
+         * @brief Set the output depth of a single oscillator (see LFOScaling)
+         * 
+         * @param index The oscillator index
+         * @param depth The depth, LFOScaling::FullDepth (65536) for full scale output
+         */
+        inline void setDepth(size_t index, uint32_t depth)
+        {
+            uint32_t offset = getOffset(index);
+            scaled -= isScaled(index);
+            depths[index] = (depth > LFOScaling::FullDepth) ? LFOScaling::FullDepth : depth;
+            applyOffset(index, offset);
+        }
+
+        /**
+         * @brief Set the output offset of a single oscillator (see LFOScaling)
+         * 
+         * @param index The oscillator index
+         * @param offset The lowest output value (unipolar) or centre output value (bipolar)
+         */
+        inline void setOffset(size_t index, uint32_t offset)
+        {
+            scaled -= isScaled(index);
+            applyOffset(index, offset);
+        }
+
+        /**
+         * @brief Set the output polarity of a single oscillator (see LFOScaling)
+         * 
+         * @param index The oscillator index
+         * @param polarity The polarity (the offset is kept)
+         */
+        inline void setPolarity(size_t index, LFOPolarity polarity)
+        {
+            uint32_t offset = getOffset(index);
+            scaled -= isScaled(index);
+            polarities[index] = polarity;
+            applyOffset(index, offset);
+        }
+
+        /**
+         * @brief Get the output depth of a single oscillator
+         * 
+         * @param index The oscillator index
+         * @return uint32_t The depth (LFOScaling::FullDepth is full scale)
+         */
+        inline uint32_t getDepth(size_t index) const { return depths[index]; }
+
+        /**
+         * @brief Get the output offset of a single oscillator
+         * 
+         * @param index The oscillator index
+         * @return uint32_t The lowest output value (unipolar) or centre output value (bipolar)
+         */
+        inline uint32_t getOffset(size_t index) const 
+        { 
+            return (polarities[index] == LFOPolarity::Bipolar) ? bases[index] + LFOScaling::scale(LFOScaling::Center, depths[index]) : bases[index]; 
+        }
+
+        /**
+         * @brief Set the counter of a single oscillator
+         * 
+         * @param index The oscillator index
+         * @param value The new 24 bit counter value
+         */
+        inline void setCounter(size_t index, uint32_t value)
+        {
+            counters[index] = value << LFOCounter::PhaseShift;
+        }
+
+        /**
+         * @brief Get the counter of a single oscillator
+         * 
+         * @param index The oscillator index
+         * @return uint32_t The oscillators 24 bit counter value
+         */
+        inline uint32_t getCounter(size_t index) const { return counters[index] >> LFOCounter::PhaseShift; }
+
+        /**
+         * @brief Reset every oscillators internal counter to 0
+         */
+        inline void reset()
+        {
+            for (size_t i = 0; i < N; i++) counters[i] = 0;
+        }
+
+    protected:
+        /**
+         * @brief The internal 32 bit phase accumulators (see LFOCounter)
+         */
+        uint32_t counters[N];
+
+        /**
+         * @brief The amount each oscillator's phase is incremented per tick
+         */
+        uint32_t increments[N];
+
+        /**
+         * @brief The selected waveform of each oscillator (index into EightBitWaveforms::tables)
+         */
+        uint8_t waveforms[N];
+
+        /**
+         * @brief The depth of each oscillator (see LFOScaling)
+         */
+        uint32_t depths[N];
+
+        /**
+         * @brief The value added to each oscillator's scaled output (its offset adjusted for the polarity)
+         */
+        uint32_t bases[N];
+
+        /**
+         * @brief The polarity of each oscillator, only read when the depth or offset changes
+         */
+        LFOPolarity polarities[N];
+
+        /**
+         * @brief The number of oscillators whose scaling is not unity
+         */
+        size_t scaled;
+
+    private:
+        //Store the base for an offset and count the oscillator if it is now scaled
+        inline void applyOffset(size_t index, uint32_t offset)
+        {
+            bases[index] = (polarities[index] == LFOPolarity::Bipolar) ? offset - LFOScaling::scale(LFOScaling::Center, depths[index]) : offset;
+            scaled += isScaled(index);
+        }
+
+        inline size_t isScaled(size_t index) const
+        {
+            return ((depths[index] != LFOScaling::FullDepth) || (bases[index] != 0)) ? 1 : 0;
+        }
+};
+
+#endif
@@ -59,44 +59,292 @@
 #ifndef _LFO_CALCULATOR_H_
 #define _LFO_CALCULATOR_H_
 
-#include "BaseLFO.h"
+#include "LFOCounter.h"
+#include "LFOExp2.h"
+
+/**
+ * @brief Increment value calculations shared by BasicLFOCalculator and RuntimeLFOCalculator
+ * 
+ * The multipliers and limits derived from the tick period are passed in, so 
+ * BasicLFOCalculator supplies compile time constants and RuntimeLFOCalculator 
+ * supplies the members it recalculates when the tick period changes.
+ * 
+ * @tparam COUNTER_BITS - The bit depth of the counter being incremented
+ */
+template <unsigned int COUNTER_BITS>
+class LFOIncrementMath
+{
+    public:
+        /**
+         * @brief Largest increment value (half the tick rate)
+         */
+        static constexpr uint32_t MaxIncrementValue = static_cast<uint32_t>(1ULL << (COUNTER_BITS - 1));
+
+        /**
+         * @brief Calculate round(2^shift * num / den) using 64 bit integers without overflowing
+         */
+        static constexpr uint64_t scaledRatio(unsigned int shift, uint64_t num, uint64_t den)
+        {
+            return ((1ULL << shift) / den) * num + (((1ULL << shift) % den) * num + den / 2) / den;
+        }
+
+        /**
+         * @brief Find the largest fixed point shift that keeps 2^(COUNTER_BITS + shift) * num / den within limit
+         * 
+         *  Searches upwards so the ratio never overflows.  Returns 0 when even no shift exceeds the limit.
+         */
+        static constexpr unsigned int largestShift(uint64_t num, uint64_t den, uint64_t limit, unsigned int shift = 0)
+        {
+            return ((COUNTER_BITS + shift < 63) && (scaledRatio(COUNTER_BITS + shift + 1, num, den) <= limit)) ? 
+                    largestShift(num, den, limit, shift + 1) : shift;
+        }
+
+        /**
+         * @brief Maximum frequency in millihertz for a tick period of num / den seconds (limited to 32 bits)
+         */
+        static constexpr uint32_t maxFrequencyMilliHz(uint64_t num, uint64_t den)
+        {
+            return ((1000ULL * den) / (2ULL * num) > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : static_cast<uint32_t>((1000ULL * den) / (2ULL * num));
+        }
+
+        /**
+         * @brief Minimum period in milliseconds for a tick period of num / den seconds
+         */
+        static constexpr uint32_t minPeriodMs(uint64_t num, uint64_t den)
+        {
+            return static_cast<uint32_t>((2000ULL * num + den - 1) / den);
+        }
+
+        /**
+         * @brief Limit an increment value to 1 ... MaxIncrementValue
+         */
+        inline static uint32_t limit(uint64_t countIncrement)
+        {
+            if (countIncrement > MaxIncrementValue) return MaxIncrementValue;
+            if (countIncrement < 1) return 1;
+            return static_cast<uint32_t>(countIncrement);
+        }
+
+        /**
+         * @brief Increment value for a period in seconds (see BasicLFOCalculator::getIncrementValueForPeriod())
+         */
+        inline static uint32_t forPeriod(float periodSeconds, float minPeriod, float maxPeriod, float freqToCount)
+        {
+            if (periodSeconds > maxPeriod) periodSeconds = maxPeriod;
+            if (periodSeconds < minPeriod) periodSeconds = minPeriod;
+            float countIncrement = freqToCount / periodSeconds;
+            return static_cast<uint32_t>(countIncrement);
+        }
+
+        /**
+         * @brief Increment value for a frequency in hertz (see BasicLFOCalculator::getIncrementValueForFrequency())
+         */
+        inline static uint32_t forFrequency(float freqHertz, float minFrequency, float maxFrequency, float freqToCount)
+        {
+            if (freqHertz > maxFrequency) freqHertz = maxFrequency;
+            if (freqHertz < minFrequency) freqHertz = minFrequency;
+            //Now Setting Frequency Only Performs a Single Floating Point Multiply
+            float countIncrement = freqHertz * freqToCount;
+            return static_cast<uint32_t>(countIncrement);
+        }
+
+        /**
+         * @brief Increment value for a frequency in millihertz (see BasicLFOCalculator::getIncrementValueForFrequencyMilliHz())
+         */
+        inline static uint32_t forFrequencyMilliHz(uint32_t freqMilliHertz, uint32_t maxMilliHz, uint32_t multiplier, unsigned int shift)
+        {
+            if (freqMilliHertz > maxMilliHz) freqMilliHertz = maxMilliHz;
+            return limit((static_cast<uint64_t>(freqMilliHertz) * multiplier) >> shift);
+        }
+
+        /**
+         * @brief Increment value for an exponential frequency (see BasicLFOCalculator::getIncrementValueForOctave())
+         */
+        inline static uint32_t forOctave(int32_t octaves, uint64_t multiplier, unsigned int multiplierShift)
+        {
+            //Whole octaves become a shift, the fraction comes from the table
+            int32_t shift = static_cast<int32_t>(LFOExp2::ValueBits + multiplierShift) - (octaves >> LFOExp2::FractionBits);
+            if (shift < 0) return MaxIncrementValue;
+            if (shift > 63) return 1;
+            uint64_t value = multiplier * LFOExp2::fraction(static_cast<uint32_t>(octaves));
+            return limit(value >> shift);
+        }
+
+        /**
+         * @brief Increment value for a period in milliseconds (see BasicLFOCalculator::getIncrementValueForPeriodMs())
+         */
+        inline static uint32_t forPeriodMs(uint32_t periodMilliseconds, uint32_t minPeriod, uint64_t dividend)
+        {
+            if (periodMilliseconds < minPeriod) periodMilliseconds = minPeriod;
+            if (periodMilliseconds < 1) periodMilliseconds = 1;
+            //Use a cheaper 32 bit division when the dividend allows
+            if (dividend <= 0xFFFFFFFFULL) return limit(static_cast<uint32_t>(dividend) / periodMilliseconds);
+#if UINTPTR_MAX > 0xFFFFFFFFUL
+            return limit(dividend / periodMilliseconds);
+#else
+            //A 64 bit division is a large library routine on 8 and 32 bit processors
+            return limit(longDivide(dividend, periodMilliseconds));
+#endif
+        }
+
+        /**
+         * @brief Calculate a * b / divisor with a 64 bit intermediate product
+         * 
+         *  Uses native 64 bit arithmetic on 64 bit processors and 
+         *  longMultiplyDivide() everywhere else.
+         * 
+         * @param a The first factor
+         * @param b The second factor
+         * @param divisor The divisor (not 0)
+         * @return uint32_t The quotient, or 0xFFFFFFFF if it does not fit in 32 bits
+         */
+        static inline uint32_t multiplyDivide(uint32_t a, uint32_t b, uint32_t divisor)
+        {
+#if UINTPTR_MAX > 0xFFFFFFFFUL
+            uint64_t quotient = (static_cast<uint64_t>(a) * b) / divisor;
+            return (quotient > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : static_cast<uint32_t>(quotient);
+#else
+            return longMultiplyDivide(a, b, divisor);
+#endif
+        }
+
+        /**
+         * @brief Calculate a * b / divisor using 32 bit multiplies and divisions only
+         * 
+         *  The 64 bit product is built from four 16 by 16 bit partial products 
+         *  and divided with longDivide(), so no 64 bit library routines are linked.
+         * 
+         * @param a The first factor
+         * @param b The second factor
+         * @param divisor The divisor (not 0)
+         * @return uint32_t The quotient, or 0xFFFFFFFF if it does not fit in 32 bits
+         */
+        static uint32_t longMultiplyDivide(uint32_t a, uint32_t b, uint32_t divisor)
+        {
+            const uint32_t aLow = a & 0xFFFF, aHigh = a >> 16;
+            const uint32_t bLow = b & 0xFFFF, bHigh = b >> 16;
+            const uint32_t low = aLow * bLow;
+            const uint32_t middle = aHigh * bLow + (low >> 16);
+            const uint32_t other = aLow * bHigh + (middle & 0xFFFF);
+            const uint32_t productHigh = aHigh * bHigh + (middle >> 16) + (other >> 16);
+            const uint32_t productLow = (other << 16) | (low & 0xFFFF);
+            return longDivide((static_cast<uint64_t>(productHigh) << 32) | productLow, divisor);
+        }
+
+        /**
+         * @brief Divide a 64 bit dividend by a 32 bit divisor using 32 bit divisions only
+         * 
+         *  Long division in two 16 bit digits with a normalized divisor (Hacker's Delight, 
+         *  divlu), so the quotient is exact.  Used for getIncrementValueForPeriodMs() where 
+         *  there is no native 64 bit division.
+         * 
+         * @param dividend The dividend
+         * @param divisor The divisor (not 0)
+         * @return uint32_t The quotient, or 0xFFFFFFFF if it does not fit in 32 bits
+         */
+        static uint32_t longDivide(uint64_t dividend, uint32_t divisor)
+        {
+            const uint32_t digit = 0x10000UL;
+            uint32_t high = static_cast<uint32_t>(dividend >> 32);
+            uint32_t low = static_cast<uint32_t>(dividend);
+            if (high >= divisor) return 0xFFFFFFFFUL;
+            //Normalize, so the top bit of the divisor is set
+            unsigned int shift = 0;
+            for (unsigned int step = 16; step > 0; step >>= 1)
+            {
+                if (divisor < (1UL << (32 - step)))
+                {
+                    divisor <<= step;
+                    shift += step;
+                }
+            }
+            if (shift)
+            {
+                high = (high << shift) | (low >> (32 - shift));
+                low <<= shift;
+            }
+            const uint32_t divisorHigh = divisor >> 16;
+            const uint32_t divisorLow = divisor & 0xFFFF;
+            const uint32_t lowHigh = low >> 16;
+            const uint32_t lowLow = low & 0xFFFF;
+            //Estimate each quotient digit from the top digit of the divisor and correct it (at most twice)
+            uint32_t quotientHigh = high / divisorHigh;
+            uint32_t rest = high - quotientHigh * divisorHigh;
+            while ((quotientHigh >= digit) || (quotientHigh * divisorLow > digit * rest + lowHigh))
+            {
+                quotientHigh--;
+                rest += divisorHigh;
+                if (rest >= digit) break;
+            }
+            const uint32_t middle = high * digit + lowHigh - quotientHigh * divisor;
+            uint32_t quotientLow = middle / divisorHigh;
+            rest = middle - quotientLow * divisorHigh;
+            while ((quotientLow >= digit) || (quotientLow * divisorLow > digit * rest + lowLow))
+            {
+                quotientLow--;
+                rest += divisorHigh;
+                if (rest >= digit) break;
+            }
+            return quotientHigh * digit + quotientLow;
+        }
+};
 
 /**
  * @brief Class providing LFO period and frequency calculations based 
- *        on the supplied tick rate
+ *        on a tick period of TICK_NUMERATOR / TICK_DENOMINATOR seconds
  * 
- * @tparam TICK_RATE_MS - The tick rate in milliseconds (period bewteen tick() calls)
+ * This is the common implementation of LFOCalculator, LFOCalculatorHz and 
+ * LFOCalculatorUs, which only differ in how the tick rate is expressed.
+ * 
+ * The calculated increment values are for a counter of COUNTER_BITS bits.  
+ * The default is the 24 bit counter (LFOCounter::setIncrementValue()), 
+ * while LFOCounter::PhaseBitDepth gives 32 bit phase increments 
+ * (LFOCounter::setPhaseIncrement()) with 256 times finer resolution.
+ * 
+ * @tparam TICK_NUMERATOR - Numerator of the tick period in seconds
+ * @tparam TICK_DENOMINATOR - Denominator of the tick period in seconds
+ * @tparam COUNTER_BITS - The bit depth of the counter being incremented
  */
-template <unsigned long TICK_RATE_MS>
-class LFOCalculator
+template <unsigned long TICK_NUMERATOR, unsigned long TICK_DENOMINATOR, unsigned int COUNTER_BITS = LFOCounter::CounterBitDepth>
+class BasicLFOCalculator
 {
     public:
         /**
-         * @brief Amount of milliseconds in a second
+         * @brief Bit depth of the counter being incremented
          */
-        static constexpr unsigned long MillisecondsPerSecond = 1000;
+        static constexpr unsigned int CounterBitDepth = COUNTER_BITS;
 
         /**
-         * @brief Oscillator Tick Rate in milliseconds
+         * @brief Number of counts per oscillation period
          */
-        static constexpr unsigned long TickRate = TICK_RATE_MS;
+        static constexpr float CountsPerPeriod = static_cast<float>(1ULL << COUNTER_BITS);
+
+        /**
+         * @brief Numerator of the tick period in seconds
+         */
+        static constexpr unsigned long TickNumerator = TICK_NUMERATOR;
+
+        /**
+         * @brief Denominator of the tick period in seconds
+         */
+        static constexpr unsigned long TickDenominator = TICK_DENOMINATOR;
 
         /**
          * @brief Multiplier For Calculating Oscillator Increment Value
          */
-        static constexpr float FreqToCountMultiplier =  (static_cast<float>(BaseLFO::CountsPerPeriod) * static_cast<float>(TickRate)) / 
-                                                        (static_cast<float>(MillisecondsPerSecond));
+        static constexpr float FreqToCountMultiplier =  (CountsPerPeriod * static_cast<float>(TickNumerator)) / 
+                                                        (static_cast<float>(TickDenominator));
         
         /**
-         * @brief Maximum Supported Frequency
+         * @brief Maximum Supported Frequency (half the tick rate)
          */
-        static constexpr float MaxFrequency = BaseLFO::CountsPerPeriod / (FreqToCountMultiplier * 2);
+        static constexpr float MaxFrequency = CountsPerPeriod / (FreqToCountMultiplier * 2);
 
         /**
          * @brief Minimum Supported Frequency
          */
-        static constexpr float MinFrequency =   static_cast<float>(MillisecondsPerSecond) / 
-                                                (static_cast<float>(TickRate) * static_cast<float>(BaseLFO::CountsPerPeriod));
+        static constexpr float MinFrequency =   static_cast<float>(TickDenominator) / 
+                                                (static_cast<float>(TickNumerator) * CountsPerPeriod);
 
         /**
          * @brief Maximum Supported Period
@@ -116,10 +364,7 @@ class LFOCalculator
          */
         inline static uint32_t getIncrementValueForPeriod(float periodSeconds)
         {
-            if (periodSeconds > MaxPeriod) periodSeconds = MaxPeriod;
-            if (periodSeconds < MinPeriod) periodSeconds = MinPeriod;
-            float countIncrement= periodSeconds * FreqToCountMultiplier;
-            return static_cast<uint32_t>(countIncrement);
+            return Math::forPeriod(periodSeconds, MinPeriod, MaxPeriod, FreqToCountMultiplier);
         }
 
         /**
@@ -130,11 +375,394 @@ class LFOCalculator
          */
         inline static uint32_t getIncrementValueForFrequency(float freqHertz)
         {
-            if (freqHertz > MaxFrequency) freqHertz = MaxFrequency;
-            if (freqHertz < MinFrequency) freqHertz = MinFrequency;
-            //Now Setting Frequency Only Performs a Single Floating Point Multiply
-            float countIncrement= freqHertz * FreqToCountMultiplier;
-            return static_cast<uint32_t>(countIncrement);
+            return Math::forFrequency(freqHertz, MinFrequency, MaxFrequency, FreqToCountMultiplier);
         }
+
+    private:
+        static constexpr unsigned long gcd(unsigned long a, unsigned long b)
+        {
+            return (b == 0) ? a : gcd(b, a % b);
+        }
+
+    public:
+        /**
+         * @brief Numerator of the number of ticks per millisecond (reduced fraction)
+         */
+        static constexpr unsigned long TicksPerMsNumerator = TICK_DENOMINATOR / gcd(TICK_DENOMINATOR, 1000UL * TICK_NUMERATOR);
+
+        /**
+         * @brief Denominator of the number of ticks per millisecond (reduced fraction)
+         */
+        static constexpr unsigned long TicksPerMsDenominator = (1000UL * TICK_NUMERATOR) / gcd(TICK_DENOMINATOR, 1000UL * TICK_NUMERATOR);
+
+        /**
+         * @brief Get the numerator of the tick period in seconds
+         * 
+         * @return uint32_t TickNumerator
+         */
+        inline static constexpr uint32_t getTickNumerator() { return TickNumerator; }
+
+        /**
+         * @brief Get the denominator of the tick period in seconds
+         * 
+         * @return uint32_t TickDenominator
+         */
+        inline static constexpr uint32_t getTickDenominator() { return TickDenominator; }
+
+        /**
+         * @brief Get the numerator of the number of ticks per millisecond
+         * 
+         * @return uint32_t TicksPerMsNumerator
+         */
+        inline static constexpr uint32_t getTicksPerMsNumerator() { return TicksPerMsNumerator; }
+
+        /**
+         * @brief Get the denominator of the number of ticks per millisecond
+         * 
+         * @return uint32_t TicksPerMsDenominator
+         */
+        inline static constexpr uint32_t getTicksPerMsDenominator() { return TicksPerMsDenominator; }
+
+    private:
+        typedef LFOIncrementMath<COUNTER_BITS> Math;
+
+    public:
+        /**
+         * @brief Largest increment value (a frequency of MaxFrequency)
+         */
+        static constexpr uint32_t MaxIncrementValue = Math::MaxIncrementValue;
+
+        /**
+         * @brief Maximum Supported Frequency in millihertz
+         */
+        static constexpr uint32_t MaxFrequencyMilliHz = Math::maxFrequencyMilliHz(TICK_NUMERATOR, TICK_DENOMINATOR);
+
+        /**
+         * @brief Minimum Supported Period in milliseconds
+         */
+        static constexpr uint32_t MinPeriodMs = Math::minPeriodMs(TICK_NUMERATOR, TICK_DENOMINATOR);
+
+        /**
+         * @brief Fixed point shift of MilliHzToCountMultiplier (the largest that keeps it within 32 bits)
+         */
+        static constexpr unsigned int MilliHzToCountShift = Math::largestShift(TICK_NUMERATOR, TICK_DENOMINATOR * 1000ULL, 0xFFFFFFFFULL);
+
+        /**
+         * @brief Fixed point multiplier for calculating the increment value from a frequency in millihertz
+         */
+        static constexpr uint32_t MilliHzToCountMultiplier = 
+            static_cast<uint32_t>(Math::scaledRatio(COUNTER_BITS + MilliHzToCountShift, TICK_NUMERATOR, TICK_DENOMINATOR * 1000ULL));
+
+        /**
+         * @brief Dividend for calculating the increment value from a period in milliseconds
+         */
+        static constexpr uint64_t PeriodMsToCountDividend = Math::scaledRatio(COUNTER_BITS, TICK_NUMERATOR * 1000ULL, TICK_DENOMINATOR);
+
+        /**
+         * @brief Number of fraction bits of an exponential frequency (one octave is 1 << OctaveBits)
+         */
+        static constexpr unsigned int OctaveBits = LFOExp2::FractionBits;
+
+        /**
+         * @brief Fixed point shift of OctaveToCountMultiplier (the largest that keeps it within 33 bits)
+         */
+        static constexpr unsigned int OctaveToCountShift = Math::largestShift(TICK_NUMERATOR, TICK_DENOMINATOR, 0x1FFFFFFFFULL);
+
+        /**
+         * @brief Fixed point increment value of a 1 Hz frequency (octave 0)
+         */
+        static constexpr uint64_t OctaveToCountMultiplier = Math::scaledRatio(COUNTER_BITS + OctaveToCountShift, TICK_NUMERATOR, TICK_DENOMINATOR);
+
+        /**
+         * @brief Get the Increment Value For The Provided Frequency (integer only)
+         * 
+         * Uses a precomputed fixed point multiplier, so no floating point code is required.
+         * 
+         * @param freqMilliHertz The desired frequency in millihertz
+         * @return uint32_t The increment value
+         */
+        inline static uint32_t getIncrementValueForFrequencyMilliHz(uint32_t freqMilliHertz)
+        {
+            return Math::forFrequencyMilliHz(freqMilliHertz, MaxFrequencyMilliHz, MilliHzToCountMultiplier, MilliHzToCountShift);
+        }
+
+        /**
+         * @brief Get the Increment Value For an Exponential Frequency (integer only)
+         * 
+         * The frequency is 2^(octaves / 2^OctaveBits) Hz, so each step of 
+         * 1 << OctaveBits doubles it (like a volts per octave control voltage), 
+         * 0 is 1 Hz and negative values are below 1 Hz.  Uses LFOExp2 and one 
+         * fixed point multiply instead of powf().
+         * 
+         * @param octaves The frequency in octaves relative to 1 Hz, with OctaveBits fraction bits
+         * @return uint32_t The increment value
+         */
+        inline static uint32_t getIncrementValueForOctave(int32_t octaves)
+        {
+            static_assert(OctaveToCountMultiplier <= 0x1FFFFFFFFULL, "Tick period too long for exponential frequencies");
+            return Math::forOctave(octaves, OctaveToCountMultiplier, OctaveToCountShift);
+        }
+
+        /**
+         * @brief Get the Increment Value For The Provided Period (integer only)
+         * 
+         * Uses a precomputed dividend, so no floating point code is required.
+         * 
+         * @param periodMilliseconds The desired period in milliseconds
+         * @return uint32_t The increment value
+         */
+        inline static uint32_t getIncrementValueForPeriodMs(uint32_t periodMilliseconds)
+        {
+            return Math::forPeriodMs(periodMilliseconds, MinPeriodMs, PeriodMsToCountDividend);
+        }
+};
+
+/**
+ * @brief Class providing LFO period and frequency calculations based 
+ *        on the supplied tick rate
+ * 
+ * @tparam TICK_RATE_MS - The tick rate in milliseconds (period bewteen tick() calls)
+ * @tparam COUNTER_BITS - The bit depth of the counter being incremented
+ */
+template <unsigned long TICK_RATE_MS, unsigned int COUNTER_BITS = LFOCounter::CounterBitDepth>
+class LFOCalculator: public BasicLFOCalculator<TICK_RATE_MS, 1000, COUNTER_BITS>
+{
+    public:
+        /**
+         * @brief Amount of milliseconds in a second
+         */
+        static constexpr unsigned long MillisecondsPerSecond = 1000;
+
+        /**
+         * @brief Oscillator Tick Rate in milliseconds
+         */
+        static constexpr unsigned long TickRate = TICK_RATE_MS;
+};
+
+/**
+ * @brief Class providing LFO period and frequency calculations based 
+ *        on a tick rate in ticks per second (for audio or sample rate clocks)
+ * 
+ * @tparam TICKS_PER_SECOND - The tick rate in Hz (e.g. 48000 for an audio callback at 48 kHz)
+ * @tparam COUNTER_BITS - The bit depth of the counter being incremented
+ */
+template <unsigned long TICKS_PER_SECOND, unsigned int COUNTER_BITS = LFOCounter::CounterBitDepth>
+class LFOCalculatorHz: public BasicLFOCalculator<1, TICKS_PER_SECOND, COUNTER_BITS>
+{
+    public:
+        /**
+         * @brief Oscillator Tick Rate in ticks per second
+         */
+        static constexpr unsigned long TicksPerSecond = TICKS_PER_SECOND;
+};
+
+/**
+ * @brief Class providing LFO period and frequency calculations based 
+ *        on a tick period in microseconds (for fast timer interrupts)
+ * 
+ * @tparam TICK_RATE_US - The tick rate in microseconds (period bewteen tick() calls)
+ * @tparam COUNTER_BITS - The bit depth of the counter being incremented
+ */
+template <unsigned long TICK_RATE_US, unsigned int COUNTER_BITS = LFOCounter::CounterBitDepth>
+class LFOCalculatorUs: public BasicLFOCalculator<TICK_RATE_US, 1000000UL, COUNTER_BITS>
+{
+    public:
+        /**
+         * @brief Amount of microseconds in a second
+         */
+        static constexpr unsigned long MicrosecondsPerSecond = 1000000UL;
+
+        /**
+         * @brief Oscillator Tick Rate in microseconds
+         */
+        static constexpr unsigned long TickRate = TICK_RATE_US;
+};
+
+/**
+ * @brief Class providing LFO period and frequency calculations based 
+ *        on a tick period chosen at run time
+ * 
+ * Provides the same functions as BasicLFOCalculator, but the tick period is 
+ * a member which may be changed with setTickPeriod(), so a single class 
+ * serves every tick rate.  All of the multipliers are recalculated once per 
+ * change, so the increment calculations cost the same as with a compile time 
+ * tick rate (setFrequency() is still a single floating point multiply).
+ * 
+ * The tick period may be up to 2^(33 - COUNTER_BITS) seconds for 
+ * getIncrementValueForOctave() to cover the whole range (2 seconds for 
+ * 32 bit phase increments).
+ * 
+ * @tparam COUNTER_BITS - The bit depth of the counter being incremented
+ */
+template <unsigned int COUNTER_BITS = LFOCounter::CounterBitDepth>
+class RuntimeLFOCalculator
+{
+    public:
+        /**
+         * @brief Bit depth of the counter being incremented
+         */
+        static constexpr unsigned int CounterBitDepth = COUNTER_BITS;
+
+        /**
+         * @brief Number of counts per oscillation period
+         */
+        static constexpr float CountsPerPeriod = static_cast<float>(1ULL << COUNTER_BITS);
+
+        /**
+         * @brief Largest increment value (a frequency of MaxFrequency)
+         */
+        static constexpr uint32_t MaxIncrementValue = LFOIncrementMath<COUNTER_BITS>::MaxIncrementValue;
+
+        /**
+         * @brief Number of fraction bits of an exponential frequency (one octave is 1 << OctaveBits)
+         */
+        static constexpr unsigned int OctaveBits = LFOExp2::FractionBits;
+
+        /**
+         * @brief Construct a new RuntimeLFOCalculator object
+         * 
+         * @param tickNumerator Numerator of the tick period in seconds
+         * @param tickDenominator Denominator of the tick period in seconds
+         */
+        RuntimeLFOCalculator(uint32_t tickNumerator = 1, uint32_t tickDenominator = 1000)
+        {
+            setTickPeriod(tickNumerator, tickDenominator);
+        }
+
+        /**
+         * @brief Set the tick period and recalculate the multipliers
+         * 
+         *  setTickPeriod(10, 1000) is a 10 ms tick, setTickPeriod(1, 48000) a 48 kHz tick
+         * 
+         * @param tickNumerator Numerator of the tick period in seconds
+         * @param tickDenominator Denominator of the tick period in seconds
+         */
+        void setTickPeriod(uint32_t tickNumerator, uint32_t tickDenominator)
+        {
+            if (tickNumerator < 1) tickNumerator = 1;
+            if (tickDenominator < 1) tickDenominator = 1;
+            uint32_t g = gcd(tickNumerator, tickDenominator);
+            tick_numerator = tickNumerator / g;
+            tick_denominator = tickDenominator / g;
+
+            freq_to_count = (CountsPerPeriod * static_cast<float>(tick_numerator)) / static_cast<float>(tick_denominator);
+            max_frequency = CountsPerPeriod / (freq_to_count * 2);
+            min_frequency = static_cast<float>(tick_denominator) / (static_cast<float>(tick_numerator) * CountsPerPeriod);
+            max_period = 1.f / min_frequency;
+            min_period = 1.f / max_frequency;
+
+            uint64_t ms = 1000ULL * tick_numerator;
+            uint64_t msDivisor = gcd(tick_denominator, ms);
+            ticks_per_ms_numerator = static_cast<uint32_t>(tick_denominator / msDivisor);
+            ticks_per_ms_denominator = static_cast<uint32_t>(ms / msDivisor);
+
+            max_frequency_milli_hz = Math::maxFrequencyMilliHz(tick_numerator, tick_denominator);
+            min_period_ms = Math::minPeriodMs(tick_numerator, tick_denominator);
+
+            milli_hz_shift = Math::largestShift(tick_numerator, 1000ULL * tick_denominator, 0xFFFFFFFFULL);
+            milli_hz_multiplier = static_cast<uint32_t>(Math::scaledRatio(COUNTER_BITS + milli_hz_shift, tick_numerator, 1000ULL * tick_denominator));
+            period_ms_dividend = Math::scaledRatio(COUNTER_BITS, 1000ULL * tick_numerator, tick_denominator);
+            octave_shift = Math::largestShift(tick_numerator, tick_denominator, 0x1FFFFFFFFULL);
+            octave_multiplier = Math::scaledRatio(COUNTER_BITS + octave_shift, tick_numerator, tick_denominator);
+            if (octave_multiplier > 0x1FFFFFFFFULL) octave_multiplier = 0x1FFFFFFFFULL;
+        }
+
+        uint32_t getTickNumerator() const { return tick_numerator; }                        //!< Get the numerator of the tick period in seconds (reduced fraction)
+        uint32_t getTickDenominator() const { return tick_denominator; }                    //!< Get the denominator of the tick period in seconds (reduced fraction)
+        uint32_t getTicksPerMsNumerator() const { return ticks_per_ms_numerator; }          //!< Get the numerator of the number of ticks per millisecond
+        uint32_t getTicksPerMsDenominator() const { return ticks_per_ms_denominator; }      //!< Get the denominator of the number of ticks per millisecond
+        float getFreqToCountMultiplier() const { return freq_to_count; }                    //!< Get the multiplier for calculating the increment value
+        float getMaxFrequency() const { return max_frequency; }                             //!< Get the maximum supported frequency (half the tick rate)
+        float getMinFrequency() const { return min_frequency; }                             //!< Get the minimum supported frequency
+        float getMaxPeriod() const { return max_period; }                                   //!< Get the maximum supported period
+        float getMinPeriod() const { return min_period; }                                   //!< Get the minimum supported period
+        uint32_t getMaxFrequencyMilliHz() const { return max_frequency_milli_hz; }          //!< Get the maximum supported frequency in millihertz
+        uint32_t getMinPeriodMs() const { return min_period_ms; }                           //!< Get the minimum supported period in milliseconds
+
+        /**
+         * @brief Get the Increment Value For The Provided Period
+         * 
+         * @param periodSeconds The desired period in seconds
+         * @return uint32_t The increment value
+         */
+        inline uint32_t getIncrementValueForPeriod(float periodSeconds) const
+        {
+            return Math::forPeriod(periodSeconds, min_period, max_period, freq_to_count);
+        }
+
+        /**
+         * @brief Get the Increment Value For The Provided Frequency
+         * 
+         * @param freqHertz The desired frequency
+         * @return uint32_t The increment value
+         */
+        inline uint32_t getIncrementValueForFrequency(float freqHertz) const
+        {
+            return Math::forFrequency(freqHertz, min_frequency, max_frequency, freq_to_count);
+        }
+
+        /**
+         * @brief Get the Increment Value For The Provided Frequency (integer only)
+         * 
+         * @param freqMilliHertz The desired frequency in millihertz
+         * @return uint32_t The increment value
+         */
+        inline uint32_t getIncrementValueForFrequencyMilliHz(uint32_t freqMilliHertz) const
+        {
+            return Math::forFrequencyMilliHz(freqMilliHertz, max_frequency_milli_hz, milli_hz_multiplier, milli_hz_shift);
+        }
+
+        /**
+         * @brief Get the Increment Value For an Exponential Frequency (integer only, see BasicLFOCalculator::getIncrementValueForOctave())
+         * 
+         * @param octaves The frequency in octaves relative to 1 Hz, with OctaveBits fraction bits
+         * @return uint32_t The increment value
+         */
+        inline uint32_t getIncrementValueForOctave(int32_t octaves) const
+        {
+            return Math::forOctave(octaves, octave_multiplier, octave_shift);
+        }
+
+        /**
+         * @brief Get the Increment Value For The Provided Period (integer only)
+         * 
+         * @param periodMilliseconds The desired period in milliseconds
+         * @return uint32_t The increment value
+         */
+        inline uint32_t getIncrementValueForPeriodMs(uint32_t periodMilliseconds) const
+        {
+            return Math::forPeriodMs(periodMilliseconds, min_period_ms, period_ms_dividend);
+        }
+
+    private:
+        typedef LFOIncrementMath<COUNTER_BITS> Math;
+
+        static uint64_t gcd(uint64_t a, uint64_t b)
+        {
+            while (b != 0)
+            {
+                uint64_t r = a % b;
+                a = b;
+                b = r;
+            }
+            return a;
+        }
+
+        uint32_t tick_numerator;            //!< Numerator of the tick period in seconds
+        uint32_t tick_denominator;          //!< Denominator of the tick period in seconds
+        uint32_t ticks_per_ms_numerator;    //!< Numerator of the number of ticks per millisecond
+        uint32_t ticks_per_ms_denominator;  //!< Denominator of the number of ticks per millisecond
+        float freq_to_count;                //!< Multiplier for calculating the increment value from a frequency
+        float max_frequency;                //!< Maximum supported frequency
+        float min_frequency;                //!< Minimum supported frequency
+        float max_period;                   //!< Maximum supported period
+        float min_period;                   //!< Minimum supported period
+        uint32_t max_frequency_milli_hz;    //!< Maximum supported frequency in millihertz
+        uint32_t min_period_ms;             //!< Minimum supported period in milliseconds
+        uint32_t milli_hz_multiplier;       //!< Fixed point multiplier for frequencies in millihertz
+        uint64_t period_ms_dividend;        //!< Dividend for periods in milliseconds
+        uint64_t octave_multiplier;         //!< Fixed point increment value of a 1 Hz frequency
+        uint8_t milli_hz_shift;             //!< Fixed point shift of milli_hz_multiplier
+        uint8_t octave_shift;               //!< Fixed point shift of octave_multiplier
 };
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,414 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file LFOCounter.h 
+//!  @brief LFOCounter class definition
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef _LFO_COUNTER_H_
+#define _LFO_COUNTER_H_
+
+#include <Arduino.h>
+#include "Waveforms/Interpolation.h"
+#include "LFOScaling.h"
+#include "LFOOutputFormat.h"
+
+/**
+ * @brief Non-virtual oscillator counter shared by all LFO classes
+ * 
+ *  Holds a 32 bit phase accumulator and increment and provides ticking and 
+ *  counter access, but no output.  The accumulator wraps around through 
+ *  native unsigned overflow, so tick() is a single addition.  The 24 bit 
+ *  counter interface is kept as the upper 24 bits of the accumulator, and 
+ *  the full 32 bit phase provides 256 times finer frequency resolution.  Classes that do not need a virtual 
+ *  getValue() (such as StaticLFO) derive directly from this class and 
+ *  carry no vtable pointer.
+ * 
+ */
+class LFOCounter
+{
+    public:
+        /**
+         * @brief Bit Depth of the LFO's Internal Counter
+         */
+        static constexpr unsigned int CounterBitDepth = 24;
+        
+        /**
+         * @brief Number of counts (ticks) per oscillation period
+         */
+        static constexpr unsigned long CountsPerPeriod = (1UL << CounterBitDepth);
+
+        /**
+         * @brief Bit Depth of the LFO's internal phase accumulator
+         */
+        static constexpr unsigned int PhaseBitDepth = 32;
+
+        /**
+         * @brief Number of extra phase bits below the 24 bit counter
+         */
+        static constexpr unsigned int PhaseShift = PhaseBitDepth - CounterBitDepth;
+
+        /**
+         * @brief Construct a new LFOCounter object
+         */
+        LFOCounter(): tick_increment(0), counter(0){}
+
+        /**
+         * @brief Sets the increment value
+         * 
+         * @param value The new value (maximum value is CountsPerPeriod)
+         */
+        inline void setIncrementValue(uint32_t value){ tick_increment = value << PhaseShift; };
+
+        /**
+         * @brief Sets the 32 bit phase increment value
+         * 
+         * @param value The new value (a full period is 2^32)
+         */
+        inline void setPhaseIncrement(uint32_t value){ tick_increment = value; };
+
+        /**
+         * @brief Increment the oscillator.
+         * 
+         * This function should be called at a constant rate in order to "run" the oscillator
+         * 
+         */
+        inline void tick()
+        {
+            counter += tick_increment;
+        }
+
+        /**
+         * @brief Advance the oscillator by several ticks at once
+         * 
+         * Equivalent to calling tick() the supplied number of times, in constant time 
+         * (the phase wraps around exactly as it would tick by tick)
+         * 
+         * @param ticks The number of ticks to advance
+         */
+        inline void advance(uint32_t ticks)
+        {
+            counter += ticks * tick_increment;
+        }
+
+        /**
+         * @brief Reset the oscillators internal counter to 0
+         * 
+         */
+        inline void reset(){ counter = 0; }
+
+        /**
+         * @brief Gets the current counter value.
+         * 
+         * @return uint32_t The oscillators 24 bit counter value
+         */
+        uint32_t getCounter() const { return counter >> PhaseShift; };
+
+        /**
+         * @brief Get the increment value (how much the counter is incremented per tick)
+         * 
+         * @return uint32_t The oscillators 24 bit increment value
+         */
+        uint32_t getIncrementValue() const { return tick_increment >> PhaseShift; };
+
+        /**
+         * @brief Get the 32 bit phase increment value
+         * 
+         * @return uint32_t The oscillators 32 bit phase increment value
+         */
+        uint32_t getPhaseIncrement() const { return tick_increment; };
+
+        /**
+         * @brief Sets the oscillators internal counter to the supplied value
+         * 
+         * @param value The new 24 bit counter value
+         */
+        void setCounter(uint32_t value){ counter = value << PhaseShift; };
+
+        /**
+         * @brief Gets the current 32 bit phase
+         * 
+         * @return uint32_t The oscillators 32 bit phase accumulator value
+         */
+        uint32_t getPhase() const { return counter; };
+
+        /**
+         * @brief Sets the oscillators 32 bit phase to the supplied value
+         * 
+         * @param value The new 32 bit phase
+         */
+        void setPhase(uint32_t value){ counter = value; };
+
+        /**
+         * @brief Set the phase from a time base shared by several oscillators
+         * 
+         * Computes the phase the oscillator would have if it had ticked at the 
+         * current increment since the epoch, with one multiply instead of 
+         * accumulating.  Oscillators on different boards given the same time 
+         * stay phase aligned.  Only the lower 32 bits of the tick count affect 
+         * the result, because the phase wraps around at 2^32.
+         * 
+         * @param epochTicks The number of ticks since the shared epoch
+         * @param phaseAtEpoch The 32 bit phase at the epoch
+         */
+        inline void setPhaseFromTime(uint64_t epochTicks, uint32_t phaseAtEpoch = 0)
+        {
+            counter = phaseAtEpoch + static_cast<uint32_t>(epochTicks) * tick_increment;
+        }
+
+        /**
+         * @brief Check if the internal counter is more than half way
+         * 
+         * @return true If counter its more than halfway (wave output is positive)
+         * @return false If not (wave output is negative)
+         */
+        bool isHalfway() const { return (( getCounter() > (CountsPerPeriod / 2) ) ? true : false); };
+
+    protected:
+        /**
+         * @brief Render a block of values from the supplied table
+         * 
+         *  Equivalent to reading the table at the counter followed by tick() n times
+         * 
+         * @tparam WAVEFORMS The waveform table class (such as EightBitWaveforms)
+         * @tparam INTERPOLATION The interpolation policy (such as LinearInterpolation)
+         * @param table The waveform table to read from
+         * @param out Buffer receiving the 24 bit output values
+         * @param n The number of values to render
+         */
+        template <class WAVEFORMS, class INTERPOLATION = LinearInterpolation>
+        inline void renderTable(typename WAVEFORMS::Table table, uint32_t *out, size_t n)
+        {
+            //Work on local copies so the counter stays in a register for the whole block
+            uint32_t c = counter;
+            const uint32_t inc = tick_increment;
+            for (size_t s = 0; s < n; s++)
+            {
+                out[s] = INTERPOLATION::template interpolate<WAVEFORMS>(table, c);
+                c += inc;
+            }
+            counter = c;
+        }
+
+        /**
+         * @brief Tick and render a block of values from the supplied table
+         * 
+         *  Equivalent to tick() followed by reading the table at the counter n times
+         * 
+         * @tparam WAVEFORMS The waveform table class (such as EightBitWaveforms)
+         * @tparam INTERPOLATION The interpolation policy (such as LinearInterpolation)
+         * @param table The waveform table to read from
+         * @param out Buffer receiving the 24 bit output values
+         * @param n The number of values to render
+         */
+        template <class WAVEFORMS, class INTERPOLATION = LinearInterpolation>
+        inline void tickAndRenderTable(typename WAVEFORMS::Table table, uint32_t *out, size_t n)
+        {
+            uint32_t c = counter;
+            const uint32_t inc = tick_increment;
+            for (size_t s = 0; s < n; s++)
+            {
+                c += inc;
+                out[s] = INTERPOLATION::template interpolate<WAVEFORMS>(table, c);
+            }
+            counter = c;
+        }
+
+        /**
+         * @brief Render a block of scaled values from the supplied table
+         * 
+         *  Same as renderTable(), with the scaling applied to each value in the same loop
+         * 
+         * @tparam WAVEFORMS The waveform table class (such as EightBitWaveforms)
+         * @tparam INTERPOLATION The interpolation policy (such as LinearInterpolation)
+         * @param table The waveform table to read from
+         * @param scaling The depth and offset to apply
+         * @param out Buffer receiving the 24 bit output values
+         * @param n The number of values to render
+         */
+        template <class WAVEFORMS, class INTERPOLATION = LinearInterpolation>
+        inline void renderTable(typename WAVEFORMS::Table table, const LFOScaling &scaling, uint32_t *out, size_t n)
+        {
+            if (scaling.isUnity())
+            {
+                renderTable<WAVEFORMS, INTERPOLATION>(table, out, n);
+                return;
+            }
+            uint32_t c = counter;
+            const uint32_t inc = tick_increment;
+            const uint32_t depth = scaling.getDepth();
+            const uint32_t base = scaling.getBase();
+            for (size_t s = 0; s < n; s++)
+            {
+                out[s] = base + LFOScaling::scale(INTERPOLATION::template interpolate<WAVEFORMS>(table, c), depth);
+                c += inc;
+            }
+            counter = c;
+        }
+
+        /**
+         * @brief Tick and render a block of scaled values from the supplied table
+         * 
+         *  Same as tickAndRenderTable(), with the scaling applied to each value in the same loop
+         * 
+         * @tparam WAVEFORMS The waveform table class (such as EightBitWaveforms)
+         * @tparam INTERPOLATION The interpolation policy (such as LinearInterpolation)
+         * @param table The waveform table to read from
+         * @param scaling The depth and offset to apply
+         * @param out Buffer receiving the 24 bit output values
+         * @param n The number of values to render
+         */
+        template <class WAVEFORMS, class INTERPOLATION = LinearInterpolation>
+        inline void tickAndRenderTable(typename WAVEFORMS::Table table, const LFOScaling &scaling, uint32_t *out, size_t n)
+        {
+            if (scaling.isUnity())
+            {
+                tickAndRenderTable<WAVEFORMS, INTERPOLATION>(table, out, n);
+                return;
+            }
+            uint32_t c = counter;
+            const uint32_t inc = tick_increment;
+            const uint32_t depth = scaling.getDepth();
+            const uint32_t base = scaling.getBase();
+            for (size_t s = 0; s < n; s++)
+            {
+                c += inc;
+                out[s] = base + LFOScaling::scale(INTERPOLATION::template interpolate<WAVEFORMS>(table, c), depth);
+            }
+            counter = c;
+        }
+
+        /**
+         * @brief Render a block of scaled, quantized output samples from the supplied table
+         * 
+         *  Same as renderTable(), with the scaling and quantization applied to each value in the same loop
+         * 
+         * @tparam WAVEFORMS The waveform table class (such as EightBitWaveforms)
+         * @tparam INTERPOLATION The interpolation policy (such as LinearInterpolation)
+         * @tparam FORMAT The output format (such as LFOOutput10Bit)
+         * @tparam DITHER The dither class (LFONoDither, LFOTPDFDither or LFONoiseShapedDither)
+         * @param table The waveform table to read from
+         * @param scaling The depth and offset to apply
+         * @param out Buffer receiving the output samples
+         * @param n The number of samples to render
+         * @param dither The dither state
+         */
+        template <class WAVEFORMS, class INTERPOLATION, class FORMAT, class DITHER>
+        inline void renderTableOutput(typename WAVEFORMS::Table table, const LFOScaling &scaling, 
+                                      typename FORMAT::Sample *out, size_t n, DITHER &dither)
+        {
+            if (scaling.isUnity()) outputLoop<false, false, WAVEFORMS, INTERPOLATION, FORMAT>(table, scaling, out, n, dither);
+            else outputLoop<false, true, WAVEFORMS, INTERPOLATION, FORMAT>(table, scaling, out, n, dither);
+        }
+
+        /**
+         * @brief Tick and render a block of scaled, quantized output samples from the supplied table
+         * 
+         *  Same as tickAndRenderTable(), with the scaling and quantization applied to each value in the same loop
+         * 
+         * @tparam WAVEFORMS The waveform table class (such as EightBitWaveforms)
+         * @tparam INTERPOLATION The interpolation policy (such as LinearInterpolation)
+         * @tparam FORMAT The output format (such as LFOOutput10Bit)
+         * @tparam DITHER The dither class (LFONoDither, LFOTPDFDither or LFONoiseShapedDither)
+         * @param table The waveform table to read from
+         * @param scaling The depth and offset to apply
+         * @param out Buffer receiving the output samples
+         * @param n The number of samples to render
+         * @param dither The dither state
+         */
+        template <class WAVEFORMS, class INTERPOLATION, class FORMAT, class DITHER>
+        inline void tickAndRenderTableOutput(typename WAVEFORMS::Table table, const LFOScaling &scaling, 
+                                             typename FORMAT::Sample *out, size_t n, DITHER &dither)
+        {
+            if (scaling.isUnity()) outputLoop<true, false, WAVEFORMS, INTERPOLATION, FORMAT>(table, scaling, out, n, dither);
+            else outputLoop<true, true, WAVEFORMS, INTERPOLATION, FORMAT>(table, scaling, out, n, dither);
+        }
+
+        /**
+         * @brief The loop of renderTableOutput() and tickAndRenderTableOutput()
+         * 
+         * @tparam TICK_FIRST Whether to tick before (tickAndRenderTableOutput()) or after (renderTableOutput()) each sample
+         * @tparam SCALED Whether to apply the scaling (false when it is unity)
+         */
+        template <bool TICK_FIRST, bool SCALED, class WAVEFORMS, class INTERPOLATION, class FORMAT, class DITHER>
+        inline void outputLoop(typename WAVEFORMS::Table table, const LFOScaling &scaling, 
+                               typename FORMAT::Sample *out, size_t n, DITHER &dither)
+        {
+            uint32_t c = counter;
+            const uint32_t inc = tick_increment;
+            const uint32_t depth = scaling.getDepth();
+            const uint32_t base = scaling.getBase();
+            for (size_t s = 0; s < n; s++)
+            {
+                if (TICK_FIRST) c += inc;
+                uint32_t value = INTERPOLATION::template interpolate<WAVEFORMS>(table, c);
+                if (SCALED) value = base + LFOScaling::scale(value, depth);
+                out[s] = FORMAT::convert(dither.template quantize<FORMAT>(value));
+                if (!TICK_FIRST) c += inc;
+            }
+            counter = c;
+        }
+
+        /**
+         * @brief The amount the oscillator's phase is incremented per tick
+         */
+        uint32_t tick_increment;
+
+        /**
+         * @brief The internal 32 bit phase accumulator (the counter is its upper 24 bits)
+         */
+        uint32_t counter;
+};
+
+#endif
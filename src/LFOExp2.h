@@ -0,0 +1,124 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file LFOExp2.h 
+//!  @brief LFOExp2 class definition (table based base 2 exponential)
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#ifndef _LFO_EXP2_H_
+#define _LFO_EXP2_H_
+
+#include <Arduino.h>
+#include "Waveforms/WaveformGenerator.h"
+
+/**
+ * @brief Static class providing a fast fixed point base 2 exponential
+ * 
+ * Used to convert exponential (volts per octave style) frequency controls 
+ * to phase increments without powf().  The fractional part of the exponent 
+ * is looked up in a 65 entry table covering one octave (generated at compile 
+ * time) and linearly interpolated, which is accurate to about 0.0015%.
+ */
+class LFOExp2
+{
+    public:
+        LFOExp2() = delete; //!< Unconstructable class
+
+        /**
+         * @brief Number of fraction bits of the exponent
+         */
+        static constexpr unsigned int FractionBits = 16;
+
+        /**
+         * @brief Number of fraction bits of the table values (the result of fraction())
+         */
+        static constexpr unsigned int ValueBits = 30;
+
+        /**
+         * @brief Number of exponent fraction bits used to index the table
+         */
+        static constexpr unsigned int IndexBits = 6;
+
+        /**
+         * @brief Number of table entries (one more than the segments, so interpolation never wraps)
+         */
+        static constexpr unsigned int TableSize = (1U << IndexBits) + 1;
+
+        /**
+         * @brief Type of the table
+         */
+        typedef WaveformArray<uint32_t, TableSize> Array;
+
+        /**
+         * @brief 2^(index / 64) with ValueBits fraction bits
+         */
+        static constexpr Array table = WaveformGenerator::generate<Exp2Shape<ValueBits + 1, TableSize - 1>, uint32_t, TableSize>();
+
+        /**
+         * @brief Calculate 2 to the power of a fraction
+         * 
+         * @param fraction The exponent from 0 to 1 with FractionBits fraction bits (only the fraction bits are used)
+         * @return uint32_t 2^fraction, from 1.0 to 2.0 with ValueBits fraction bits
+         */
+        static inline uint32_t fraction(uint32_t fraction)
+        {
+            const unsigned int shift = FractionBits - IndexBits;
+            uint32_t index = (fraction >> shift) & ((1U << IndexBits) - 1);
+            uint32_t position = fraction & ((1U << shift) - 1);
+            uint32_t a = table[index];
+            //The difference is below 2^25, so dropping 4 bits keeps the product within 32 bits
+            return a + ((((table[index + 1] - a) >> 4) * position) >> (shift - 4));
+        }
+};
+
+#endif
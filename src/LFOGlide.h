@@ -0,0 +1,271 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file LFOGlide.h 
+//!  @brief LFOGlide class definition (frequency glide/portamento)
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#ifndef _LFO_GLIDE_H_
+#define _LFO_GLIDE_H_
+
+#include <Arduino.h>
+
+/**
+ * @brief The shape of a frequency glide
+ */
+enum class LFOGlideShape
+{
+    Linear = 0,     //!< The frequency changes by the same amount every tick
+    Exponential     //!< The frequency changes by the same ratio every tick (even speed on a musical scale)
+};
+
+/**
+ * @brief Integer ramp of a phase increment from its current value to a target
+ * 
+ *  The ramp is a series of linear segments, each with a precomputed integer step,
+ *  so a running glide costs one add, one decrement and one compare per tick.
+ *  A linear glide is a single segment.  An exponential glide is split into 
+ *  Segments segments whose end points follow the exponential curve (each is 
+ *  the previous one times a fixed ratio), which keeps it within about half a 
+ *  percent of a true exponential for a 200 to 1 glide.  The next segment is set up when a 
+ *  segment ends, using integer math only.  The final increment is always 
+ *  exactly the target.
+ */
+class LFOGlide
+{
+    public:
+        /**
+         * @brief Number of square roots taken to get the segment ratio from the total ratio
+         */
+        static constexpr unsigned int SegmentRoots = 5;
+
+        /**
+         * @brief Number of linear segments of an exponential glide
+         */
+        static constexpr unsigned int Segments = 1U << SegmentRoots;
+
+        /**
+         * @brief Number of fraction bits of the segment ratio
+         */
+        static constexpr unsigned int RatioBits = 24;
+
+        /**
+         * @brief Construct a new LFOGlide object (not gliding)
+         */
+        LFOGlide(): step(0), ticks(0), total_ticks(0), segment_end(0), target(0), ratio(0), segments(0){}
+
+        /**
+         * @brief Start a glide
+         * 
+         *  Exponential glides between very different increments (a ratio over 65536) 
+         *  or from/to 0 glide linearly instead.
+         * 
+         * @param from The current phase increment
+         * @param to The target phase increment
+         * @param totalTicks The length of the glide in ticks (0 sets the target immediately)
+         * @param shape The shape of the glide
+         * @return uint32_t The phase increment to use for the next tick
+         */
+        uint32_t start(uint32_t from, uint32_t to, uint32_t totalTicks, LFOGlideShape shape)
+        {
+            stop();
+            target = to;
+            if ((totalTicks == 0) || (from == to)) return to;
+            segments = 1;
+            total_ticks = totalTicks;
+            segment_end = to;
+            if ((shape == LFOGlideShape::Exponential) && (totalTicks >= Segments) && (from != 0) && (to != 0))
+            {
+                uint64_t total = (static_cast<uint64_t>(to) << RatioBits) / from;
+                if ((total >= (1ULL << (RatioBits - 16))) && (total < (1ULL << (RatioBits + 16))))
+                {
+                    //The Segments'th root of the total ratio is SegmentRoots square roots
+                    uint64_t r = total;
+                    for (unsigned int i = 0; i < SegmentRoots; i++) r = squareRoot(r << RatioBits);
+                    ratio = static_cast<uint32_t>(r);
+                    segments = Segments;
+                    segment_end = scaleByRatio(from);
+                }
+            }
+            begin(from);
+            return from;
+        }
+
+        /**
+         * @brief Stop the glide, leaving the increment where it is
+         */
+        inline void stop()
+        {
+            ticks = 0;
+            segments = 0;
+            ratio = 0;
+        }
+
+        /**
+         * @brief Check if a glide is running
+         * 
+         * @return true If the increment is still changing
+         */
+        inline bool isActive() const { return ticks != 0; }
+
+        /**
+         * @brief Get the target of the last glide
+         * 
+         * @return uint32_t The target phase increment
+         */
+        uint32_t getTarget() const { return target; }
+
+        /**
+         * @brief Move the increment one tick along the glide
+         * 
+         * @param increment The phase increment being ramped
+         */
+        inline void tick(uint32_t &increment)
+        {
+            if (ticks)
+            {
+                increment += step;
+                if (--ticks == 0) nextSegment(increment);
+            }
+        }
+
+        /**
+         * @brief Move the increment several ticks along the glide, in constant time per segment
+         * 
+         *  Equivalent to adding the increment to the phase and calling tick() n times
+         * 
+         * @param increment The phase increment being ramped
+         * @param n The number of ticks
+         * @return uint32_t The total phase change over the n ticks
+         */
+        uint32_t advance(uint32_t &increment, uint32_t n)
+        {
+            uint32_t phase = 0;
+            while (n && ticks)
+            {
+                uint32_t m = (n < ticks) ? n : ticks;
+                //Sum of increment + k * step for k = 0 .. m - 1 (modulo 2^32, like the phase itself)
+                uint64_t triangle = (static_cast<uint64_t>(m) * (m - 1)) / 2;
+                phase += m * increment + static_cast<uint32_t>(step) * static_cast<uint32_t>(triangle);
+                increment += static_cast<uint32_t>(step) * m;
+                n -= m;
+                ticks -= m;
+                if (ticks == 0) nextSegment(increment);
+            }
+            return phase + n * increment;
+        }
+
+    protected:
+        /**
+         * @brief Set up the step of the current segment from the current increment to segment_end
+         * 
+         *  Segment k of n ends at tick total_ticks * k / n, so the remainder is spread over the segments
+         */
+        inline void begin(uint32_t increment)
+        {
+            const unsigned int n = (ratio == 0) ? 1 : Segments;
+            const unsigned int k = n - segments;
+            uint32_t length = static_cast<uint32_t>((static_cast<uint64_t>(total_ticks) * (k + 1)) / n - (static_cast<uint64_t>(total_ticks) * k) / n);
+            ticks = length;
+            //The difference may be 2^31 or more, so divide in 64 bits (a one tick segment truncates the step, but ends on segment_end anyway)
+            int64_t difference = static_cast<int64_t>(segment_end) - static_cast<int64_t>(increment);
+            step = static_cast<int32_t>(difference / static_cast<int64_t>(length));
+        }
+
+        /**
+         * @brief Finish a segment exactly at its end point and start the next one
+         */
+        void nextSegment(uint32_t &increment)
+        {
+            increment = segment_end;
+            if (--segments == 0) return;
+            segment_end = (segments == 1) ? target : scaleByRatio(segment_end);
+            begin(increment);
+        }
+
+        inline uint32_t scaleByRatio(uint32_t value) const
+        {
+            return static_cast<uint32_t>((static_cast<uint64_t>(value) * ratio) >> RatioBits);
+        }
+
+        /**
+         * @brief Integer square root (rounded down)
+         */
+        static uint64_t squareRoot(uint64_t value)
+        {
+            uint64_t root = 0;
+            uint64_t bit = 1ULL << 62;
+            while (bit > value) bit >>= 2;
+            while (bit)
+            {
+                if (value >= root + bit)
+                {
+                    value -= root + bit;
+                    root = (root >> 1) + bit;
+                }
+                else root >>= 1;
+                bit >>= 2;
+            }
+            return root;
+        }
+
+        int32_t step;               //!< The change of the increment per tick in the current segment
+        uint32_t ticks;             //!< Ticks left in the current segment (0 when not gliding)
+        uint32_t total_ticks;       //!< The length of the whole glide
+        uint32_t segment_end;       //!< The increment at the end of the current segment
+        uint32_t target;            //!< The increment at the end of the glide
+        uint32_t ratio;             //!< The ratio between segment end points (RatioBits fraction bits)
+        uint8_t segments;           //!< Segments left, including the current one
+};
+
+#endif
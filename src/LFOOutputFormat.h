@@ -0,0 +1,261 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file LFOOutputFormat.h 
+//!  @brief DAC/PWM output formats and dithering for LFO output
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#ifndef _LFO_OUTPUT_FORMAT_H_
+#define _LFO_OUTPUT_FORMAT_H_
+
+#include <Arduino.h>
+
+/**
+ * @brief Selects the sample type of an output format (see LFOOutputFormat)
+ * 
+ * @tparam SMALL - True for formats of 8 bits or less
+ * @tparam SIGNED - True for signed formats
+ */
+template <bool SMALL, bool SIGNED> struct LFOSampleType;
+template <> struct LFOSampleType<true, false> { typedef uint8_t Type; };
+template <> struct LFOSampleType<true, true> { typedef int8_t Type; };
+template <> struct LFOSampleType<false, false> { typedef uint16_t Type; };
+template <> struct LFOSampleType<false, true> { typedef int16_t Type; };
+
+/**
+ * @brief An N bit output format for DAC's and PWM outputs
+ * 
+ *  Unsigned formats output levels from 0 to Max.  Signed formats output 
+ *  two's complement values centred on 0 (the centre of the 24 bit range), 
+ *  for bipolar DAC's and audio codecs.
+ * 
+ * @tparam BITS - The number of output bits (8 to 16)
+ * @tparam SIGNED - Whether the output is signed
+ */
+template <unsigned int BITS, bool SIGNED = false>
+class LFOOutputFormat
+{
+    static_assert((BITS >= 8) && (BITS <= 16), "Output formats must have 8 to 16 bits");
+
+    public:
+        /**
+         * @brief The number of output bits
+         */
+        static constexpr unsigned int Bits = BITS;
+
+        /**
+         * @brief The number of bits dropped from the 24 bit LFO output
+         */
+        static constexpr unsigned int Shift = 24 - BITS;
+
+        /**
+         * @brief The highest output level
+         */
+        static constexpr uint32_t Max = (1UL << BITS) - 1;
+
+        /**
+         * @brief The type of one output sample
+         */
+        typedef typename LFOSampleType<(BITS <= 8), SIGNED>::Type Sample;
+
+        /**
+         * @brief Convert an output level (0 to Max) to a sample
+         * 
+         * @param level The quantized output level
+         * @return Sample The sample
+         */
+        static inline Sample convert(uint32_t level)
+        {
+            return static_cast<Sample>(SIGNED ? static_cast<int32_t>(level) - static_cast<int32_t>(1UL << (BITS - 1)) : level);
+        }
+};
+
+typedef LFOOutputFormat<8> LFOOutput8Bit;                   //!< 8 bit unsigned (for example analogWrite() on AVR boards)
+typedef LFOOutputFormat<10> LFOOutput10Bit;                 //!< 10 bit unsigned
+typedef LFOOutputFormat<12> LFOOutput12Bit;                 //!< 12 bit unsigned (for example the SAMD and Due DAC's)
+typedef LFOOutputFormat<16> LFOOutput16Bit;                 //!< 16 bit unsigned
+typedef LFOOutputFormat<8, true> LFOOutputSigned8Bit;       //!< 8 bit signed
+typedef LFOOutputFormat<16, true> LFOOutputSigned16Bit;     //!< 16 bit signed (for example audio codecs)
+
+/**
+ * @brief Quantize an already dithered value to an output level
+ * 
+ *  Values below 0 (wrapped around by the dither or by the LFO's offset) 
+ *  give level 0 and values above the range give the highest level.
+ * 
+ * @tparam FORMAT - The output format
+ * @param value The rounded value (24 bit scale)
+ * @return uint32_t The output level (0 to FORMAT::Max)
+ */
+template <class FORMAT>
+inline uint32_t quantizeLFOOutput(int32_t value)
+{
+    if (value < 0) return 0;
+    uint32_t level = static_cast<uint32_t>(value) >> FORMAT::Shift;
+    return (level > FORMAT::Max) ? FORMAT::Max : level;
+}
+
+/**
+ * @brief Round to the nearest output level without dithering
+ */
+class LFONoDither
+{
+    public:
+        /**
+         * @brief Quantize a 24 bit LFO output value
+         * 
+         * @tparam FORMAT - The output format
+         * @param value The 24 bit value
+         * @return uint32_t The output level (0 to FORMAT::Max)
+         */
+        template <class FORMAT>
+        inline uint32_t quantize(uint32_t value)
+        {
+            return quantizeLFOOutput<FORMAT>(static_cast<int32_t>(value) + static_cast<int32_t>(1UL << (FORMAT::Shift - 1)));
+        }
+};
+
+/**
+ * @brief Triangular (TPDF) dither before quantizing
+ * 
+ *  Adds the sum of two uniform random values of one output step each, which 
+ *  turns the quantization error into noise that does not depend on the 
+ *  signal (slow LFO's no longer step visibly between levels).  Both random 
+ *  values come from one xorshift32 step (shifts and exclusive ors only).
+ */
+class LFOTPDFDither
+{
+    public:
+        /**
+         * @brief Construct a new LFOTPDFDither object
+         * 
+         * @param seed The random generator seed (must not be 0)
+         */
+        explicit LFOTPDFDither(uint32_t seed = 0x9E3779B9UL): state(seed){}
+
+        /**
+         * @brief Quantize a 24 bit LFO output value
+         * 
+         * @tparam FORMAT - The output format
+         * @param value The 24 bit value
+         * @return uint32_t The output level (0 to FORMAT::Max)
+         */
+        template <class FORMAT>
+        inline uint32_t quantize(uint32_t value)
+        {
+            return quantizeLFOOutput<FORMAT>(static_cast<int32_t>(value) + noise<FORMAT>());
+        }
+
+    protected:
+        /**
+         * @brief Get the next triangular noise value, including the rounding offset
+         * 
+         * @tparam FORMAT - The output format
+         * @return int32_t The noise (-1 to +1 output steps, plus half a step for rounding)
+         */
+        template <class FORMAT>
+        inline int32_t noise()
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            const uint32_t mask = (1UL << FORMAT::Shift) - 1;
+            return static_cast<int32_t>((state & mask) + ((state >> 16) & mask)) - static_cast<int32_t>(mask) + static_cast<int32_t>(1UL << (FORMAT::Shift - 1));
+        }
+
+        uint32_t state;     //!< The xorshift32 state
+};
+
+/**
+ * @brief Noise shaped (first order error feedback) TPDF dither
+ * 
+ *  Each value's quantization error is subtracted from the next value, which 
+ *  moves the dither noise up to high frequencies where it is easily filtered 
+ *  (for example by the RC filter after a PWM output), far above the LFO's 
+ *  frequency.  Use one object per output, since it stores the last error.
+ */
+class LFONoiseShapedDither: public LFOTPDFDither
+{
+    public:
+        /**
+         * @brief Construct a new LFONoiseShapedDither object
+         * 
+         * @param seed The random generator seed (must not be 0)
+         */
+        explicit LFONoiseShapedDither(uint32_t seed = 0x9E3779B9UL): LFOTPDFDither(seed), error(0){}
+
+        /**
+         * @brief Quantize a 24 bit LFO output value
+         * 
+         * @tparam FORMAT - The output format
+         * @param value The 24 bit value
+         * @return uint32_t The output level (0 to FORMAT::Max)
+         */
+        template <class FORMAT>
+        inline uint32_t quantize(uint32_t value)
+        {
+            int32_t target = static_cast<int32_t>(value) + error;
+            uint32_t level = quantizeLFOOutput<FORMAT>(target + noise<FORMAT>());
+            //Limit the error so values clipped at the ends of the range cannot accumulate it
+            const int32_t limit = static_cast<int32_t>(1UL << (FORMAT::Shift + 1));
+            error = target - static_cast<int32_t>(level << FORMAT::Shift);
+            if (error > limit) error = limit;
+            else if (error < -limit) error = -limit;
+            return level;
+        }
+
+    private:
+        int32_t error;      //!< The quantization error of the last value (24 bit scale)
+};
+
+#endif
@@ -0,0 +1,326 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file LFORenderEngine.h 
+//!  @brief Multi-threaded offline rendering of many LFO's (host only)
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#ifndef _LFO_RENDER_ENGINE_H_
+#define _LFO_RENDER_ENGINE_H_
+
+//Host only: uses the C++ standard thread library, which Arduino targets do not provide
+#ifndef ARDUINO
+
+#include "BaseLFO.h"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Output buffers for rendering many LFO's, one per LFO
+ * 
+ * Every buffer starts on its own cache line and is padded to a whole number 
+ * of cache lines, so threads writing different LFO's never share a cache line.
+ */
+class LFORenderBuffers
+{
+    public:
+        /**
+         * @brief Cache line size in bytes
+         */
+        static constexpr size_t CacheLineSize = 64;
+
+        /**
+         * @brief Number of values per cache line
+         */
+        static constexpr size_t ValuesPerLine = CacheLineSize / sizeof(uint32_t);
+
+        /**
+         * @brief Allocate the buffers
+         * 
+         * @param count The number of LFO's
+         * @param samples The number of values per LFO
+         */
+        LFORenderBuffers(size_t count, size_t samples): 
+            count(count), samples(samples), stride((samples + ValuesPerLine - 1) / ValuesPerLine * ValuesPerLine),
+            storage(new uint32_t[count * stride + ValuesPerLine])
+        {
+            uintptr_t address = reinterpret_cast<uintptr_t>(storage.get());
+            base = storage.get() + ((CacheLineSize - address % CacheLineSize) % CacheLineSize) / sizeof(uint32_t);
+        }
+
+        /**
+         * @brief Get an LFO's buffer
+         * 
+         * @param index The LFO's index
+         * @return uint32_t* The buffer of samples() values
+         */
+        uint32_t *operator[](size_t index) { return base + index * stride; }
+        const uint32_t *operator[](size_t index) const { return base + index * stride; }
+
+        size_t size() const { return count; }               //!< The number of buffers
+        size_t getSamples() const { return samples; }       //!< The number of values per buffer
+
+    private:
+        size_t count;
+        size_t samples;
+        size_t stride;
+        std::unique_ptr<uint32_t[]> storage;
+        uint32_t *base;
+};
+
+/**
+ * @brief Renders large numbers of LFO's in parallel on a work stealing thread pool
+ * 
+ * Each worker starts with an equal share of the LFO's and renders them one by 
+ * one.  A worker that runs out of work steals half of the remaining LFO's of 
+ * another worker, so the load stays balanced when LFO's differ in cost 
+ * (for example virtual render() overrides or different waveform tables).
+ * 
+ *     LFORenderEngine engine;                      //One worker per core
+ *     LFORenderBuffers buffers(lfos.size(), 48000);
+ *     engine.render(lfos.data(), lfos.size(), buffers);
+ */
+class LFORenderEngine
+{
+    public:
+        /**
+         * @brief Start the worker threads
+         * 
+         * @param threads The number of threads rendering (including the caller of render()), 0 for one per core
+         */
+        explicit LFORenderEngine(unsigned int threads = 0):
+            workers((threads > 0) ? threads : ((std::thread::hardware_concurrency() > 0) ? std::thread::hardware_concurrency() : 1)),
+            rangeStorage(new char[(workers + 1) * LFORenderBuffers::CacheLineSize]), generation(0), running(0), stopping(false)
+        {
+            //new Range[] only guarantees alignof(std::max_align_t) before C++17, so the ranges are placed on cache line boundaries by hand
+            uintptr_t address = reinterpret_cast<uintptr_t>(rangeStorage.get());
+            char *aligned = rangeStorage.get() + (LFORenderBuffers::CacheLineSize - address % LFORenderBuffers::CacheLineSize) % LFORenderBuffers::CacheLineSize;
+            ranges = reinterpret_cast<Range *>(aligned);
+            for (unsigned int w = 0; w < workers; w++) new (&ranges[w]) Range();
+            for (unsigned int w = 1; w < workers; w++)
+            {
+                pool.emplace_back([this, w]{ workerLoop(w); });
+            }
+        }
+
+        LFORenderEngine(const LFORenderEngine &) = delete;
+        LFORenderEngine &operator=(const LFORenderEngine &) = delete;
+
+        ~LFORenderEngine()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            wake.notify_all();
+            for (std::thread &thread : pool) thread.join();
+        }
+
+        /**
+         * @brief Get the number of rendering threads
+         * 
+         * @return unsigned int The number of threads
+         */
+        unsigned int getThreads() const { return workers; }
+
+        /**
+         * @brief Render every LFO into its buffer (see BaseLFO::render())
+         * 
+         * Blocks until all LFO's are rendered.  Each LFO is rendered by a single thread.
+         * 
+         * @param lfos The LFO's to render
+         * @param count The number of LFO's
+         * @param buffers The output buffers (at least count buffers)
+         */
+        void render(BaseLFO *const *lfos, size_t count, LFORenderBuffers &buffers)
+        {
+            job.lfos = lfos;
+            job.buffers = &buffers;
+            for (unsigned int w = 0; w < workers; w++)
+            {
+                ranges[w].store(pack(count * w / workers, count * (w + 1) / workers));
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                running = workers - 1;
+                generation++;
+            }
+            wake.notify_all();
+            work(0);
+            std::unique_lock<std::mutex> lock(mutex);
+            done.wait(lock, [this]{ return running == 0; });
+        }
+
+    private:
+        /**
+         * @brief A worker's remaining LFO's [begin, end), packed into one atomic word 
+         *        (padded so each worker's range has its own cache line)
+         */
+        struct Range
+        {
+            std::atomic<uint64_t> packed;
+            char padding[LFORenderBuffers::CacheLineSize - sizeof(std::atomic<uint64_t>)];
+
+            Range(): packed(0){}
+            uint64_t load() const { return packed.load(); }
+            void store(uint64_t range) { packed.store(range); }
+            bool compareExchange(uint64_t &expected, uint64_t desired) { return packed.compare_exchange_weak(expected, desired); }
+        };
+
+        static_assert(sizeof(Range) == LFORenderBuffers::CacheLineSize, "Each Range must fill exactly one cache line");
+        static_assert(std::is_trivially_destructible<Range>::value, "The ranges are never destroyed");
+
+        static uint64_t pack(uint64_t begin, uint64_t end) { return (begin << 32) | end; }
+        static uint32_t begin(uint64_t range) { return static_cast<uint32_t>(range >> 32); }
+        static uint32_t end(uint64_t range) { return static_cast<uint32_t>(range); }
+
+        void renderOne(size_t index)
+        {
+            job.lfos[index]->render((*job.buffers)[index], job.buffers->getSamples());
+        }
+
+        //Take the next LFO from the front of a worker's own range
+        bool takeOwn(unsigned int w, size_t &index)
+        {
+            uint64_t range = ranges[w].load();
+            while (begin(range) < end(range))
+            {
+                if (ranges[w].compareExchange(range, pack(begin(range) + 1, end(range))))
+                {
+                    index = begin(range);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        //Move the back half of another worker's range to this worker
+        bool steal(unsigned int w)
+        {
+            for (unsigned int i = 1; i < workers; i++)
+            {
+                unsigned int victim = (w + i) % workers;
+                uint64_t range = ranges[victim].load();
+                while (begin(range) < end(range))
+                {
+                    uint32_t middle = begin(range) + (end(range) - begin(range)) / 2;
+                    if (ranges[victim].compareExchange(range, pack(begin(range), middle)))
+                    {
+                        ranges[w].store(pack(middle, end(range)));
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        void work(unsigned int w)
+        {
+            size_t index;
+            do
+            {
+                while (takeOwn(w, index)) renderOne(index);
+            } while (steal(w));
+        }
+
+        void workerLoop(unsigned int w)
+        {
+            unsigned long seen = 0;
+            for (;;)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    wake.wait(lock, [this, seen]{ return stopping || (generation != seen); });
+                    if (stopping) return;
+                    seen = generation;
+                }
+                work(w);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    running--;
+                }
+                done.notify_one();
+            }
+        }
+
+        /**
+         * @brief The current render() call
+         */
+        struct Job
+        {
+            BaseLFO *const *lfos;
+            LFORenderBuffers *buffers;
+        };
+
+        unsigned int workers;
+        std::unique_ptr<char[]> rangeStorage;
+        Range *ranges;
+        std::vector<std::thread> pool;
+        Job job;
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable done;
+        unsigned long generation;
+        unsigned int running;
+        bool stopping;
+};
+
+#endif
+
+#endif
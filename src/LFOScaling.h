@@ -0,0 +1,215 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file LFOScaling.h 
+//!  @brief LFOScaling class definition (depth and offset applied to LFO output)
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef _LFO_SCALING_H_
+#define _LFO_SCALING_H_
+
+#include <Arduino.h>
+
+/**
+ * @brief How an LFO's depth and offset are applied
+ */
+enum class LFOPolarity: uint8_t
+{
+    Unipolar = 0,   //!< The wave is scaled towards 0 and the offset is its lowest value
+    Bipolar         //!< The wave is scaled towards its centre and the offset is its centre value
+};
+
+/**
+ * @brief Depth and offset scaling of 24 bit LFO output values
+ * 
+ *  The output is offset + value * depth, calculated with integer multiplies 
+ *  and shifts only (no division).  The offset is folded into a single base 
+ *  value whenever the settings change, so applying the scaling costs two 
+ *  multiplies and an add per value, and nothing but a flag test while the 
+ *  depth is full and the base is 0.  The result is not clamped, so the 
+ *  offset and depth should keep the output within the 24 bit range (for 
+ *  example a bipolar offset of FullScale / 2 allows any depth).
+ */
+class LFOScaling
+{
+    public:
+        /**
+         * @brief Number of fraction bits of the depth value
+         */
+        static constexpr unsigned int DepthBits = 16;
+
+        /**
+         * @brief Depth value for full scale (unscaled) output
+         */
+        static constexpr uint32_t FullDepth = (1UL << DepthBits);
+
+        /**
+         * @brief Number of output values (the output is 24 bits)
+         */
+        static constexpr uint32_t FullScale = (1UL << 24);
+
+        /**
+         * @brief Centre of the 24 bit output range (bipolar scaling is relative to this value)
+         */
+        static constexpr uint32_t Center = FullScale / 2;
+
+        /**
+         * @brief Construct a new LFOScaling object (unipolar, full depth and no offset)
+         */
+        LFOScaling(): depth(FullDepth), base(0), polarity(LFOPolarity::Unipolar), unity(true){}
+
+        /**
+         * @brief Scale a 24 bit value by a depth
+         * 
+         *  Calculates value * depth / FullDepth exactly, split into two 
+         *  16 bit by 17 bit multiplies so no 64 bit arithmetic is needed.
+         * 
+         * @param value The 24 bit value
+         * @param depth The depth (0 to FullDepth)
+         * @return uint32_t The scaled value
+         */
+        static inline uint32_t scale(uint32_t value, uint32_t depth)
+        {
+            return ((value >> 8) * depth + (((value & 0xFF) * depth) >> 8)) >> 8;
+        }
+
+        /**
+         * @brief Apply the scaling to an output value (skipped while the scaling is unity)
+         * 
+         * @param value The 24 bit output value
+         * @return uint32_t The scaled output value
+         */
+        inline uint32_t apply(uint32_t value) const
+        {
+            return unity ? value : base + scale(value, depth);
+        }
+
+        /**
+         * @brief Check if the scaling leaves output values unchanged
+         * 
+         * @return true If apply() returns its argument
+         */
+        inline bool isUnity() const { return unity; }
+
+        /**
+         * @brief Set the depth, keeping the offset
+         * 
+         * @param value The new depth (FullDepth for full scale, larger values are limited to FullDepth)
+         */
+        void setDepth(uint32_t value)
+        {
+            uint32_t offset = getOffset();
+            depth = (value > FullDepth) ? FullDepth : value;
+            setOffset(offset);
+        }
+
+        /**
+         * @brief Set the offset
+         * 
+         * @param offset The lowest output value (unipolar) or centre output value (bipolar)
+         */
+        void setOffset(uint32_t offset)
+        {
+            base = (polarity == LFOPolarity::Bipolar) ? offset - scale(Center, depth) : offset;
+            unity = (depth == FullDepth) && (base == 0);
+        }
+
+        /**
+         * @brief Set the polarity, keeping the offset
+         * 
+         * @param value The new polarity
+         */
+        void setPolarity(LFOPolarity value)
+        {
+            uint32_t offset = getOffset();
+            polarity = value;
+            setOffset(offset);
+        }
+
+        /**
+         * @brief Get the depth
+         * 
+         * @return uint32_t The depth (FullDepth is full scale)
+         */
+        uint32_t getDepth() const { return depth; }
+
+        /**
+         * @brief Get the offset
+         * 
+         * @return uint32_t The lowest output value (unipolar) or centre output value (bipolar)
+         */
+        uint32_t getOffset() const { return (polarity == LFOPolarity::Bipolar) ? base + scale(Center, depth) : base; }
+
+        /**
+         * @brief Get the polarity
+         * 
+         * @return LFOPolarity The polarity
+         */
+        LFOPolarity getPolarity() const { return polarity; }
+
+        /**
+         * @brief Get the value added to every scaled output (the offset adjusted for the polarity)
+         * 
+         * @return uint32_t The base value
+         */
+        uint32_t getBase() const { return base; }
+
+    private:
+        uint32_t depth;
+        uint32_t base;
+        LFOPolarity polarity;
+        bool unity;             //!< Whether apply() returns its argument (kept up to date by setOffset())
+};
+
+#endif
@@ -0,0 +1,334 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file LFOScheduler.h 
+//!  @brief LFOScheduler class definition
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#ifndef _LFO_SCHEDULER_H_
+#define _LFO_SCHEDULER_H_
+
+#include "BaseLFO.h"
+#include "LFOAtomic.h"
+
+#ifndef ARDUINO
+#include <thread>
+#include <chrono>
+#endif
+
+/**
+ * @brief A consistent copy of an LFO's phase and output value
+ */
+struct LFOSnapshot
+{
+    uint32_t phase; //!< The 32 bit phase after the tick
+    uint32_t value; //!< The 24 bit output value at that phase
+};
+
+/**
+ * @brief Ticks a set of LFO's from a single periodic source and publishes their values
+ * 
+ * Register the LFO's with add(), then call tick() at the tick rate of the LFO's,
+ * typically from a hardware timer interrupt:
+ * 
+ *     LFOScheduler<4> scheduler;
+ *     ISR(TIMER1_COMPA_vect){ scheduler.tick(); }
+ * 
+ * On the host build, LFOSchedulerThread calls tick() from a std::thread instead.
+ * 
+ * Each tick() stores every LFO's phase and value in a snapshot protected by a 
+ * sequence counter (a seqlock).  read() never blocks or disables interrupts: 
+ * it retries if a tick happened while it was copying, so it always returns a 
+ * matching phase and value, and the ticking context never waits for readers.  
+ * Read values through the scheduler rather than calling getValue() on the LFO's, 
+ * whose 32 bit counters can be torn by an interrupt on 8-bit targets.
+ * 
+ * add() records the type of the LFO it is given and tick() calls that type's 
+ * own tick(), so wrappers such as AtomicLFO, CachedLFO, GlidingLFO and 
+ * ExtendedPrecisionLFO keep working when ticked by the scheduler (tick() is 
+ * not virtual, and would skip them if called through a BaseLFO pointer).  
+ * Pass the LFO's with their full type, not as BaseLFO pointers.
+ * 
+ * add() and remove() must not run at the same time as tick() 
+ * (register the LFO's before starting the timer).
+ * 
+ * @tparam MAX_LFOS - The maximum number of registered LFO's
+ */
+template <size_t MAX_LFOS>
+class LFOScheduler
+{
+    public:
+        /**
+         * @brief Maximum number of registered LFO's
+         */
+        static constexpr size_t MaxLFOs = MAX_LFOS;
+
+        /**
+         * @brief Construct a new LFOScheduler object
+         */
+        LFOScheduler(): count(0)
+        {
+            for (size_t i = 0; i < MAX_LFOS; i++)
+            {
+                lfos[i] = nullptr;
+                tickers[i] = nullptr;
+            }
+        }
+
+        /**
+         * @brief Register an LFO
+         * 
+         * @tparam LFO The LFO's type, whose tick() is called by tick()
+         * @param lfo The LFO to tick
+         * @return int The LFO's index for read() (-1 if the scheduler is full)
+         */
+        template <class LFO>
+        int add(LFO *lfo)
+        {
+            if (count >= MAX_LFOS) return -1;
+            lfos[count] = lfo;
+            tickers[count] = &tickAs<LFO>;
+            publish(count, lfo);
+            return static_cast<int>(count++);
+        }
+
+        /**
+         * @brief Unregister an LFO (the indices of later LFO's move down by one)
+         * 
+         * @param lfo The LFO to remove
+         */
+        void remove(BaseLFO *lfo)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                if (lfos[i] != lfo) continue;
+                count--;
+                for (size_t j = i; j < count; j++)
+                {
+                    lfos[j] = lfos[j + 1];
+                    tickers[j] = tickers[j + 1];
+                    publish(j, lfos[j]);
+                }
+                lfos[count] = nullptr;
+                tickers[count] = nullptr;
+                return;
+            }
+        }
+
+        /**
+         * @brief Get the number of registered LFO's
+         * 
+         * @return size_t The number of LFO's
+         */
+        size_t size() const { return count; }
+
+        /**
+         * @brief Tick every registered LFO and publish their new values
+         * 
+         * Call this from the timer interrupt (or thread) at the LFO tick rate
+         */
+        void tick()
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                tickers[i](lfos[i]);
+                publish(i, lfos[i]);
+            }
+        }
+
+        /**
+         * @brief Try once to read an LFO's snapshot
+         * 
+         * @param index The LFO's index (as returned by add())
+         * @param snapshot Receives the phase and value
+         * @return true The snapshot is consistent
+         * @return false A tick() interrupted the read, try again
+         */
+        bool tryRead(size_t index, LFOSnapshot &snapshot) const
+        {
+            const Slot &slot = slots[index];
+            LFOAtomic::Sequence before = slot.sequence.loadAcquire();
+            snapshot.phase = slot.phase.load();
+            snapshot.value = slot.value.load();
+            LFOAtomic::acquireFence();
+            return ((before & 1) == 0) && (slot.sequence.load() == before);
+        }
+
+        /**
+         * @brief Read an LFO's snapshot
+         * 
+         * @param index The LFO's index (as returned by add())
+         * @return LFOSnapshot The phase and value after the latest tick
+         */
+        LFOSnapshot read(size_t index) const
+        {
+            LFOSnapshot snapshot;
+            while (!tryRead(index, snapshot)) {}
+            return snapshot;
+        }
+
+        /**
+         * @brief Read an LFO's output value
+         * 
+         * @param index The LFO's index (as returned by add())
+         * @return uint32_t The 24 bit output value after the latest tick
+         */
+        uint32_t getValue(size_t index) const
+        {
+            return read(index).value;
+        }
+
+    protected:
+        /**
+         * @brief Ticks a registered LFO as its own type
+         */
+        typedef void (*Ticker)(BaseLFO *lfo);
+
+        template <class LFO>
+        static void tickAs(BaseLFO *lfo)
+        {
+            static_cast<LFO *>(lfo)->tick();
+        }
+
+        /**
+         * @brief Seqlock protected snapshot of one LFO
+         */
+        struct Slot
+        {
+            LFOShared<LFOAtomic::Sequence> sequence;    //!< Odd while the snapshot is being written
+            LFOShared<uint32_t> phase;                  //!< The snapshot phase
+            LFOShared<uint32_t> value;                  //!< The snapshot value
+        };
+
+        /**
+         * @brief Write an LFO's snapshot
+         */
+        void publish(size_t index, const BaseLFO *lfo)
+        {
+            Slot &slot = slots[index];
+            LFOAtomic::Sequence sequence = slot.sequence.load();
+            slot.sequence.store(sequence + 1);
+            LFOAtomic::releaseFence();
+            slot.phase.store(lfo->getPhase());
+            slot.value.store(lfo->getValue());
+            slot.sequence.storeRelease(sequence + 2);
+        }
+
+        BaseLFO *lfos[MAX_LFOS];        //!< The registered LFO's
+        Ticker tickers[MAX_LFOS];       //!< The tick function of each registered LFO
+        Slot slots[MAX_LFOS];           //!< The published snapshots
+        size_t count;                   //!< The number of registered LFO's
+};
+
+#ifndef ARDUINO
+/**
+ * @brief Host replacement for a hardware timer: calls an LFOScheduler's tick() from a thread
+ * 
+ * @tparam SCHEDULER - The scheduler type
+ */
+template <class SCHEDULER>
+class LFOSchedulerThread
+{
+    public:
+        /**
+         * @brief Construct a new LFOSchedulerThread object
+         * 
+         * @param scheduler The scheduler to tick
+         */
+        LFOSchedulerThread(SCHEDULER &scheduler): scheduler(scheduler), running(false){}
+
+        LFOSchedulerThread(const LFOSchedulerThread &) = delete;
+        LFOSchedulerThread &operator=(const LFOSchedulerThread &) = delete;
+
+        ~LFOSchedulerThread(){ stop(); }
+
+        /**
+         * @brief Start ticking the scheduler
+         * 
+         * @param period The time between ticks (zero ticks as fast as possible)
+         */
+        void start(std::chrono::microseconds period)
+        {
+            stop();
+            running.store(true);
+            thread = std::thread([this, period]{
+                auto next = std::chrono::steady_clock::now();
+                while (running.load(std::memory_order_relaxed))
+                {
+                    if (period.count() > 0)
+                    {
+                        next += period;
+                        std::this_thread::sleep_until(next);
+                    }
+                    scheduler.tick();
+                }
+            });
+        }
+
+        /**
+         * @brief Stop ticking the scheduler and wait for the thread to finish
+         */
+        void stop()
+        {
+            running.store(false);
+            if (thread.joinable()) thread.join();
+        }
+
+    private:
+        SCHEDULER &scheduler;
+        std::atomic<bool> running;
+        std::thread thread;
+};
+#endif
+
+#endif
@@ -0,0 +1,311 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file LFOStreamBuffer.h 
+//!  @brief LFOStreamBuffer class definition (ping-pong DMA buffer filled from LFO's)
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#ifndef _LFO_STREAM_BUFFER_H_
+#define _LFO_STREAM_BUFFER_H_
+
+#include "LFOAtomic.h"
+#include "LFOOutputFormat.h"
+
+/**
+ * @brief Circular (ping-pong) output buffer for streaming LFO's to a DAC with DMA
+ * 
+ * The buffer is split into two halves.  While the consumer (a DMA channel in 
+ * circular mode) reads one half, fill() renders the next samples of every 
+ * attached LFO into the other half.  The DMA interrupt reports progress with 
+ * onHalfComplete() (the first half has been read) and onComplete() (the 
+ * second half has been read), which only mark the half as free, so the 
+ * interrupt stays short.  fill() may then be called from loop() or from the 
+ * interrupt itself.
+ * 
+ * With several channels the samples are interleaved (left, right, left, ...), 
+ * as expected by multi-channel DAC's and audio codecs.  Each channel is 
+ * rendered by one LFO, which is ticked once per sample frame.
+ * 
+ * If a half is still waiting to be filled when the DMA comes back to it, the 
+ * DMA replays old samples.  This is counted in getUnderruns().  The samples 
+ * fill() then renders into that half are overwritten before the DMA reads 
+ * them again, so the LFO's skip one block of HALF_FRAMES frames.  This is 
+ * counted in getDropped().
+ * 
+ *     LFOStreamBuffer<DeluxeSoftwareLFOHz<48000>, LFOOutput12Bit, 128> stream;
+ *     stream.attach(0, LFO);
+ *     stream.prime();
+ *     startCircularDMA(stream.getBuffer(), stream.Size);
+ *     void DMA_Handler(){ if (halfTransfer) stream.onHalfComplete(); else stream.onComplete(); }
+ *     void loop(){ stream.fill(); }
+ * 
+ * @tparam LFO - The LFO class rendering each channel (DeluxeSoftwareLFOHz, SoftwareLFOHz or a variant)
+ * @tparam FORMAT - The output format (such as LFOOutput12Bit)
+ * @tparam HALF_FRAMES - The number of sample frames in each half of the buffer
+ * @tparam CHANNELS - The number of interleaved channels (one LFO per channel)
+ * @tparam DITHER - The dither class (LFONoDither, LFOTPDFDither or LFONoiseShapedDither)
+ */
+template <class LFO, class FORMAT, size_t HALF_FRAMES, size_t CHANNELS = 1, class DITHER = LFONoDither>
+class LFOStreamBuffer
+{
+    public:
+        /**
+         * @brief The type of one output sample
+         */
+        typedef typename FORMAT::Sample Sample;
+
+        /**
+         * @brief The number of samples in each half of the buffer
+         */
+        static constexpr size_t HalfSize = HALF_FRAMES * CHANNELS;
+
+        /**
+         * @brief The number of samples in the whole buffer
+         */
+        static constexpr size_t Size = 2 * HalfSize;
+
+        /**
+         * @brief Construct a new LFOStreamBuffer object (no LFO's attached, both halves silent)
+         */
+        LFOStreamBuffer(): next(0)
+        {
+            for (size_t c = 0; c < CHANNELS; c++) lfos[c] = nullptr;
+            for (size_t i = 0; i < Size; i++) buffer[i] = FORMAT::convert((FORMAT::Max + 1) / 2);
+            for (size_t half = 0; half < 2; half++)
+            {
+                pending[half].store(0);
+                replaying[half].store(0);
+            }
+        }
+
+        /**
+         * @brief Attach the LFO rendering a channel
+         * 
+         * @param channel The channel (0 to CHANNELS - 1)
+         * @param lfo The LFO, which must outlive the buffer (channels without an LFO stay silent)
+         */
+        void attach(size_t channel, LFO &lfo)
+        {
+            lfos[channel] = &lfo;
+        }
+
+        /**
+         * @brief Fill both halves, before starting the DMA
+         */
+        void prime()
+        {
+            render(0);
+            render(1);
+            pending[0].store(0);
+            pending[1].store(0);
+        }
+
+        /**
+         * @brief Notify that the consumer has read the first half (call from the DMA half transfer interrupt)
+         */
+        inline void onHalfComplete()
+        {
+            release(0);
+        }
+
+        /**
+         * @brief Notify that the consumer has read the second half (call from the DMA transfer complete interrupt)
+         */
+        inline void onComplete()
+        {
+            release(1);
+        }
+
+        /**
+         * @brief Render the halves which the consumer has finished reading
+         * 
+         * @return size_t The number of halves rendered (0 when the consumer is still reading)
+         */
+        size_t fill()
+        {
+            size_t filled = 0;
+            //Both halves can be free if fill() was late, the older one is read first (render() moves next on)
+            const size_t first = next;
+            for (size_t i = 0; i < 2; i++)
+            {
+                size_t half = (first + i) & 1;
+                if (pending[half].loadAcquire())
+                {
+                    render(half);
+                    //The consumer is replaying this half, so these samples are overwritten before it gets back
+                    if (replaying[half].loadAcquire())
+                    {
+                        replaying[half].store(0);
+                        increment(dropped);
+                    }
+                    pending[half].storeRelease(0);
+                    filled++;
+                }
+            }
+            return filled;
+        }
+
+        /**
+         * @brief Get the circular buffer (the DMA source address)
+         * 
+         * @return const Sample* The Size samples of the buffer
+         */
+        const Sample *getBuffer() const { return buffer; }
+
+        /**
+         * @brief Get the number of times the consumer reached a half which was not filled yet
+         * 
+         *  Call it from the main program (or the consumer's interrupt), which 
+         *  the count can interrupt but not the other way round.
+         * 
+         * @return uint32_t The number of underruns
+         */
+        uint32_t getUnderruns() const { return read(underruns); }
+
+        /**
+         * @brief Get the number of blocks rendered into a half while the consumer was replaying it
+         * 
+         *  Each dropped block is overwritten before the consumer reads it, so the 
+         *  output skips HALF_FRAMES frames of every LFO.  Call it from the 
+         *  context which calls fill(), or from one fill() cannot interrupt.
+         * 
+         * @return uint32_t The number of dropped blocks
+         */
+        uint32_t getDropped() const { return read(dropped); }
+
+    protected:
+        /**
+         * @brief Seqlock protected event counter (a 32 bit value can tear on 8-bit boards)
+         */
+        struct Counter
+        {
+            LFOShared<LFOAtomic::Sequence> sequence;    //!< Odd while the count is being written
+            LFOShared<uint32_t> count;                  //!< The number of events
+        };
+
+        /**
+         * @brief Count an event (each counter has a single writer)
+         */
+        static inline void increment(Counter &counter)
+        {
+            LFOAtomic::Sequence sequence = counter.sequence.load();
+            counter.sequence.store(sequence + 1);
+            LFOAtomic::releaseFence();
+            counter.count.store(counter.count.load() + 1);
+            counter.sequence.storeRelease(sequence + 2);
+        }
+
+        /**
+         * @brief Read a counter, retrying while an increment() interrupted the read
+         */
+        static uint32_t read(const Counter &counter)
+        {
+            for (;;)
+            {
+                LFOAtomic::Sequence before = counter.sequence.loadAcquire();
+                uint32_t count = counter.count.load();
+                LFOAtomic::acquireFence();
+                if (((before & 1) == 0) && (counter.sequence.load() == before)) return count;
+            }
+        }
+
+        /**
+         * @brief Mark a half as read, counting an underrun if the other half was never filled
+         */
+        inline void release(size_t half)
+        {
+            //A replayed half has been read again, the next block rendered into it is in time
+            replaying[half].store(0);
+            //The consumer now reads the other half, which must have been filled since it was released
+            if (pending[half ^ 1].loadAcquire())
+            {
+                increment(underruns);
+                replaying[half ^ 1].storeRelease(1);
+            }
+            pending[half].storeRelease(1);
+        }
+
+        /**
+         * @brief Render the next samples of every channel into one half
+         */
+        void render(size_t half)
+        {
+            Sample *out = buffer + half * HalfSize;
+            for (size_t c = 0; c < CHANNELS; c++)
+            {
+                if (lfos[c] == nullptr) continue;
+                if (CHANNELS == 1)
+                {
+                    lfos[c]->template renderOutput<FORMAT>(out, HALF_FRAMES, dithers[c]);
+                }
+                else
+                {
+                    lfos[c]->template renderOutput<FORMAT>(scratch, HALF_FRAMES, dithers[c]);
+                    for (size_t f = 0; f < HALF_FRAMES; f++) out[f * CHANNELS + c] = scratch[f];
+                }
+            }
+            next = half ^ 1;
+        }
+
+        Sample buffer[Size];                                //!< The circular buffer read by the consumer
+        Sample scratch[(CHANNELS > 1) ? HALF_FRAMES : 1];   //!< One channel's samples before interleaving
+        LFO *lfos[CHANNELS];                                //!< The LFO rendering each channel
+        DITHER dithers[CHANNELS];                           //!< The dither state of each channel
+        LFOShared<uint8_t> pending[2];                      //!< Whether each half has been read and must be filled
+        LFOShared<uint8_t> replaying[2];                    //!< Whether the consumer is replaying each half after an underrun
+        Counter underruns;                                  //!< The number of underruns
+        Counter dropped;                                    //!< The number of dropped blocks
+        size_t next;                                        //!< The half to fill first
+};
+
+#endif
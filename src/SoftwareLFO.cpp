@@ -60,61 +60,15 @@
 
 uint32_t BaseLFO::getValue() const
 {
-    uint32_t c = counter;
-    auto sinetable = EightBitWaveforms::sine;
-    uint32_t val = c >> 16;
-    uint32_t i = c & 0xFFFF;
-    uint32_t x = sinetable[val];
-    uint32_t y = sinetable[val + 1];
-    y = y - x;
-    y = y * i;
-    x = x << 16;
-    x = x + y;
-    return x;
+    return scaling.apply(EightBitWaveforms::interpolate(EightBitWaveforms::sine, counter));
 }
 
-uint32_t BaseDeluxeLFO::getValue() const
+void BaseLFO::render(uint32_t *out, size_t n)
 {
-    uint32_t c = counter;
-    auto table = wavetable;
-    uint32_t val = c >> 16;
-    if (val > 255) Serial.println("Val Overflow");
-    uint32_t i = c & 0xFFFF;
-    uint32_t x = table[val];
-    uint32_t y = table[val + 1];
-    y = y - x;
-    y = y * i;
-    x = x << 16;
-    x = x + y;
-    //uint32_t v = x * (uint32_t)magnitude;
-    //v = v / 0xFFFF;
-    return x;
+    renderTable<EightBitWaveforms>(EightBitWaveforms::sine, scaling, out, n);
 }
 
-void BaseDeluxeLFO::setWaveform(LFOWaveform waveform)
+void BaseLFO::tickAndRender(uint32_t *out, size_t n)
 {
-    switch(waveform)
-    {
-        case LFOWaveform::Triangle:
-            wavetable = EightBitWaveforms::triangle;
-            return;
-        case LFOWaveform::Square:
-            wavetable = EightBitWaveforms::square;
-            return;
-        case LFOWaveform::Sawtooth:
-            wavetable = EightBitWaveforms::sawtooth;
-            return;
-        case LFOWaveform::AsymmetricSine:
-            wavetable = EightBitWaveforms::asymSine;
-            return;
-        case LFOWaveform::InvertedAsymmetricSine:
-            wavetable = EightBitWaveforms::invertedAsymSine;
-            return;
-        case LFOWaveform::CompoundSine:
-            wavetable = EightBitWaveforms::compoundSine;
-            return;
-        default:
-            wavetable = EightBitWaveforms::sine;
-            return;
-    }
+    tickAndRenderTable<EightBitWaveforms>(EightBitWaveforms::sine, scaling, out, n);
 }
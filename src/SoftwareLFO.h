@@ -60,30 +60,86 @@
 
 #include <Arduino.h>
 #include "Waveforms/EightBitWaveforms.h"
+#include "Waveforms/EightBitDeltaWaveforms.h"
+#include "Waveforms/QuarterWaveSine.h"
+#include "Waveforms/WaveformTables.h"
 #include "BaseLFO.h"
+#include "BasicSineLFO.h"
 #include "LFOCalculator.h"
 #include "BaseDeluxeLFO.h"
+#include "LFOBank.h"
+#include "StaticLFO.h"
 
 /**
- * @brief Template SoftwareLFO class with period and frequency calculation.
+ * @brief Generic Software LFO combining an LFO base class with a period and frequency calculator.
  * 
- * Supply the tick rate to create a basic sine-wave Software LFO
+ * SoftwareLFO, DeluxeSoftwareLFO and their Hz/microsecond tick rate variants 
+ * are all specializations of this class.
  * 
- * @tparam TICK_RATE_MS - The tick rate in milliseconds (milliseconds between calls to tick())
+ * @tparam BASE - The LFO base class (BasicSineLFO or BasicDeluxeLFO)
+ * @tparam CALCULATOR - The calculator class for the tick rate (which must calculate 32 bit phase increments)
  */
-template <unsigned long TICK_RATE_MS>
-class SoftwareLFO: public BaseLFO, public LFOCalculator<TICK_RATE_MS>
+template <class BASE, class CALCULATOR>
+class GenericSoftwareLFO: public BASE, public CALCULATOR
 {
     public:
+        /**
+         * @brief Construct a new GenericSoftwareLFO object
+         */
+        GenericSoftwareLFO(){}
+
+        /**
+         * @brief Construct a new GenericSoftwareLFO object with a configured calculator
+         * 
+         * @param calculator The calculator to copy (for example a RuntimeLFOCalculator set up for the tick rate)
+         */
+        explicit GenericSoftwareLFO(const CALCULATOR &calculator): CALCULATOR(calculator){}
+
         inline void setPeriod(float periodSeconds)
         {
-            setIncrementValue(this->getIncrementValueForPeriod(periodSeconds));
+            this->setPhaseIncrement(this->getIncrementValueForPeriod(periodSeconds));
         }
 
         inline void setFrequency(float freqHertz)
         {
-            setIncrementValue(this->getIncrementValueForFrequency(freqHertz));
+            this->setPhaseIncrement(this->getIncrementValueForFrequency(freqHertz));
+        }
+
+        inline void setPeriodMs(uint32_t periodMilliseconds)
+        {
+            this->setPhaseIncrement(this->getIncrementValueForPeriodMs(periodMilliseconds));
+        }
+
+        inline void setFrequencyMilliHz(uint32_t freqMilliHertz)
+        {
+            this->setPhaseIncrement(this->getIncrementValueForFrequencyMilliHz(freqMilliHertz));
         }
+
+        /**
+         * @brief Set the frequency on an exponential scale (integer only, see BasicLFOCalculator::getIncrementValueForOctave())
+         * 
+         *     LFO.setFrequencyExp(analogRead(A0) * 512L - 4 * 65536L); //Knob from 1/16 Hz to 16 Hz
+         * 
+         * @param octaves The frequency in octaves relative to 1 Hz, with 16 fraction bits (65536 per octave)
+         */
+        inline void setFrequencyExp(int32_t octaves)
+        {
+            this->setPhaseIncrement(this->getIncrementValueForOctave(octaves));
+        }
+};
+
+/**
+ * @brief Template SoftwareLFO class with period and frequency calculation.
+ * 
+ * Supply the tick rate to create a basic sine-wave Software LFO
+ * 
+ * @tparam TICK_RATE_MS - The tick rate in milliseconds (milliseconds between calls to tick())
+ * @tparam WAVEFORMS - The sine table class (EightBitWaveforms, EightBitQuarterSine, SixteenBitQuarterSine or WaveformTables)
+ * @tparam INTERPOLATION - The interpolation policy (TruncatingInterpolation, LinearInterpolation or HermiteInterpolation)
+ */
+template <unsigned long TICK_RATE_MS, class WAVEFORMS = EightBitWaveforms, class INTERPOLATION = LinearInterpolation>
+class SoftwareLFO: public GenericSoftwareLFO<BasicSineLFO<WAVEFORMS, INTERPOLATION>, LFOCalculator<TICK_RATE_MS, LFOCounter::PhaseBitDepth>>
+{
 };
 
 /**
@@ -92,21 +148,191 @@ class SoftwareLFO: public BaseLFO, public LFOCalculator<TICK_RATE_MS>
  * Supply the tick rate to create a full-featured Software LFO
  * 
  * @tparam TICK_RATE_MS - The tick rate in milliseconds (milliseconds between calls to tick())
+ * @tparam WAVEFORMS - The waveform table class (EightBitWaveforms, EightBitDeltaWaveforms or WaveformTables)
+ * @tparam INTERPOLATION - The interpolation policy (TruncatingInterpolation, LinearInterpolation or HermiteInterpolation)
+ */
+template <unsigned long TICK_RATE_MS, class WAVEFORMS = EightBitWaveforms, class INTERPOLATION = LinearInterpolation>
+class DeluxeSoftwareLFO: public GenericSoftwareLFO<BasicDeluxeLFO<WAVEFORMS, INTERPOLATION>, LFOCalculator<TICK_RATE_MS, LFOCounter::PhaseBitDepth>>
+{
+};
+
+/**
+ * @brief Template SoftwareLFO class with the tick rate in ticks per second.
+ * 
+ * For LFO's ticked from an audio callback or sample clock
+ * 
+ * @tparam TICKS_PER_SECOND - The tick rate in Hz (calls to tick() per second)
+ * @tparam WAVEFORMS - The sine table class (EightBitWaveforms, EightBitQuarterSine, SixteenBitQuarterSine or WaveformTables)
+ * @tparam INTERPOLATION - The interpolation policy (TruncatingInterpolation, LinearInterpolation or HermiteInterpolation)
+ */
+template <unsigned long TICKS_PER_SECOND, class WAVEFORMS = EightBitWaveforms, class INTERPOLATION = LinearInterpolation>
+class SoftwareLFOHz: public GenericSoftwareLFO<BasicSineLFO<WAVEFORMS, INTERPOLATION>, LFOCalculatorHz<TICKS_PER_SECOND, LFOCounter::PhaseBitDepth>>
+{
+};
+
+/**
+ * @brief Template DeluxeSoftwareLFO class with the tick rate in ticks per second.
+ * 
+ * For LFO's ticked from an audio callback or sample clock
+ * 
+ * @tparam TICKS_PER_SECOND - The tick rate in Hz (calls to tick() per second)
+ * @tparam WAVEFORMS - The waveform table class (EightBitWaveforms, EightBitDeltaWaveforms or WaveformTables)
+ * @tparam INTERPOLATION - The interpolation policy (TruncatingInterpolation, LinearInterpolation or HermiteInterpolation)
+ */
+template <unsigned long TICKS_PER_SECOND, class WAVEFORMS = EightBitWaveforms, class INTERPOLATION = LinearInterpolation>
+class DeluxeSoftwareLFOHz: public GenericSoftwareLFO<BasicDeluxeLFO<WAVEFORMS, INTERPOLATION>, LFOCalculatorHz<TICKS_PER_SECOND, LFOCounter::PhaseBitDepth>>
+{
+};
+
+/**
+ * @brief Template SoftwareLFO class with the tick rate in microseconds.
+ * 
+ * For LFO's ticked from a fast timer interrupt
+ * 
+ * @tparam TICK_RATE_US - The tick rate in microseconds (microseconds between calls to tick())
+ * @tparam WAVEFORMS - The sine table class (EightBitWaveforms, EightBitQuarterSine, SixteenBitQuarterSine or WaveformTables)
+ * @tparam INTERPOLATION - The interpolation policy (TruncatingInterpolation, LinearInterpolation or HermiteInterpolation)
+ */
+template <unsigned long TICK_RATE_US, class WAVEFORMS = EightBitWaveforms, class INTERPOLATION = LinearInterpolation>
+class SoftwareLFOUs: public GenericSoftwareLFO<BasicSineLFO<WAVEFORMS, INTERPOLATION>, LFOCalculatorUs<TICK_RATE_US, LFOCounter::PhaseBitDepth>>
+{
+};
+
+/**
+ * @brief Template DeluxeSoftwareLFO class with the tick rate in microseconds.
+ * 
+ * For LFO's ticked from a fast timer interrupt
+ * 
+ * @tparam TICK_RATE_US - The tick rate in microseconds (microseconds between calls to tick())
+ * @tparam WAVEFORMS - The waveform table class (EightBitWaveforms, EightBitDeltaWaveforms or WaveformTables)
+ * @tparam INTERPOLATION - The interpolation policy (TruncatingInterpolation, LinearInterpolation or HermiteInterpolation)
+ */
+template <unsigned long TICK_RATE_US, class WAVEFORMS = EightBitWaveforms, class INTERPOLATION = LinearInterpolation>
+class DeluxeSoftwareLFOUs: public GenericSoftwareLFO<BasicDeluxeLFO<WAVEFORMS, INTERPOLATION>, LFOCalculatorUs<TICK_RATE_US, LFOCounter::PhaseBitDepth>>
+{
+};
+
+/**
+ * @brief Generic Software LFO with a tick rate which is set at run time
+ * 
+ * One class serves every tick rate (instead of one template instance per rate), 
+ * and the rate may be changed while running, for example when a scheduler sheds load.
+ * The multipliers are recalculated once per rate change (see RuntimeLFOCalculator), 
+ * so setting the frequency costs the same as with a compile time tick rate.
+ * 
+ * @tparam BASE - The LFO base class (BasicSineLFO or BasicDeluxeLFO)
  */
-template <unsigned long TICK_RATE_MS>
-class DeluxeSoftwareLFO: public BaseDeluxeLFO, public LFOCalculator<TICK_RATE_MS>
+template <class BASE>
+class GenericRuntimeSoftwareLFO: public GenericSoftwareLFO<BASE, RuntimeLFOCalculator<LFOCounter::PhaseBitDepth>>
 {
     public:
-        inline void setPeriod(float periodSeconds)
+        /**
+         * @brief Construct a new GenericRuntimeSoftwareLFO object
+         * 
+         * @param tickRateMs The tick rate in milliseconds (milliseconds between calls to tick())
+         */
+        explicit GenericRuntimeSoftwareLFO(uint32_t tickRateMs = 1): 
+            GenericSoftwareLFO<BASE, RuntimeLFOCalculator<LFOCounter::PhaseBitDepth>>(Calculator(tickRateMs, 1000)){}
+
+        /**
+         * @brief Change the tick period, keeping the current phase and frequency
+         * 
+         *  The phase increment is rescaled to the new rate.
+         * 
+         * @param tickNumerator Numerator of the tick period in seconds
+         * @param tickDenominator Denominator of the tick period in seconds
+         */
+        void setTickPeriod(uint32_t tickNumerator, uint32_t tickDenominator)
         {
-            setIncrementValue(this->getIncrementValueForPeriod(periodSeconds));
+            const uint32_t oldNumerator = this->getTickNumerator();
+            const uint32_t oldDenominator = this->getTickDenominator();
+            Calculator::setTickPeriod(tickNumerator, tickDenominator);
+            //The increment per tick scales with the tick period: new / old
+            this->tick_increment = rescale(this->tick_increment, 
+                                           static_cast<uint64_t>(this->getTickNumerator()) * oldDenominator, 
+                                           static_cast<uint64_t>(this->getTickDenominator()) * oldNumerator);
         }
 
-        inline void setFrequency(float freqHertz)
+        /**
+         * @brief Change the tick rate in milliseconds (see setTickPeriod())
+         * 
+         * @param tickRateMs Milliseconds between calls to tick()
+         */
+        inline void setTickRateMs(uint32_t tickRateMs) { setTickPeriod(tickRateMs, 1000); }
+
+        /**
+         * @brief Change the tick rate in microseconds (see setTickPeriod())
+         * 
+         * @param tickRateUs Microseconds between calls to tick()
+         */
+        inline void setTickRateUs(uint32_t tickRateUs) { setTickPeriod(tickRateUs, 1000000UL); }
+
+        /**
+         * @brief Change the tick rate in ticks per second (see setTickPeriod())
+         * 
+         * @param ticksPerSecond Calls to tick() per second
+         */
+        inline void setTickRateHz(uint32_t ticksPerSecond) { setTickPeriod(1, ticksPerSecond); }
+
+    protected:
+        typedef RuntimeLFOCalculator<LFOCounter::PhaseBitDepth> Calculator;
+
+        /**
+         * @brief Calculate value * num / den, dropping low bits of the ratio if it does not fit in 32 bits
+         */
+        static uint32_t rescale(uint32_t value, uint64_t num, uint64_t den)
         {
-            setIncrementValue(this->getIncrementValueForFrequency(freqHertz));
+            if (value == 0) return 0;
+            while (num > 0xFFFFFFFFULL || den > 0xFFFFFFFFULL)
+            {
+                num >>= 1;
+                den >>= 1;
+            }
+            if (den == 0) den = 1;
+            uint64_t scaled = (static_cast<uint64_t>(value) * num + den / 2) / den;
+            if (scaled > Calculator::MaxIncrementValue) scaled = Calculator::MaxIncrementValue;
+            if (scaled < 1) scaled = 1;
+            return static_cast<uint32_t>(scaled);
         }
 };
 
+/**
+ * @brief SoftwareLFO class with the tick rate set at run time
+ * 
+ *     RuntimeSoftwareLFO<> LFO(10);    //Ticks every 10 ms
+ *     LFO.setTickRateMs(20);           //Same frequency and phase, half as many ticks
+ * 
+ * @tparam WAVEFORMS - The sine table class (EightBitWaveforms, EightBitQuarterSine, SixteenBitQuarterSine or WaveformTables)
+ * @tparam INTERPOLATION - The interpolation policy (TruncatingInterpolation, LinearInterpolation or HermiteInterpolation)
+ */
+template <class WAVEFORMS = EightBitWaveforms, class INTERPOLATION = LinearInterpolation>
+class RuntimeSoftwareLFO: public GenericRuntimeSoftwareLFO<BasicSineLFO<WAVEFORMS, INTERPOLATION>>
+{
+    public:
+        /**
+         * @brief Construct a new RuntimeSoftwareLFO object
+         * 
+         * @param tickRateMs The tick rate in milliseconds (milliseconds between calls to tick())
+         */
+        explicit RuntimeSoftwareLFO(uint32_t tickRateMs = 1): GenericRuntimeSoftwareLFO<BasicSineLFO<WAVEFORMS, INTERPOLATION>>(tickRateMs){}
+};
+
+/**
+ * @brief DeluxeSoftwareLFO class with the tick rate set at run time (see RuntimeSoftwareLFO)
+ * 
+ * @tparam WAVEFORMS - The waveform table class (EightBitWaveforms, EightBitDeltaWaveforms or WaveformTables)
+ * @tparam INTERPOLATION - The interpolation policy (TruncatingInterpolation, LinearInterpolation or HermiteInterpolation)
+ */
+template <class WAVEFORMS = EightBitWaveforms, class INTERPOLATION = LinearInterpolation>
+class RuntimeDeluxeSoftwareLFO: public GenericRuntimeSoftwareLFO<BasicDeluxeLFO<WAVEFORMS, INTERPOLATION>>
+{
+    public:
+        /**
+         * @brief Construct a new RuntimeDeluxeSoftwareLFO object
+         * 
+         * @param tickRateMs The tick rate in milliseconds (milliseconds between calls to tick())
+         */
+        explicit RuntimeDeluxeSoftwareLFO(uint32_t tickRateMs = 1): GenericRuntimeSoftwareLFO<BasicDeluxeLFO<WAVEFORMS, INTERPOLATION>>(tickRateMs){}
+};
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,241 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file StaticLFO.h 
+//!  @brief StaticLFO class definition
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef _STATIC_LFO_H_
+#define _STATIC_LFO_H_
+
+#include "LFOCounter.h"
+#include "LFOCalculator.h"
+#include "Waveforms/EightBitWaveforms.h"
+#include "Waveforms/EightBitDeltaWaveforms.h"
+#include "Waveforms/QuarterWaveSine.h"
+
+/**
+ * @brief Template LFO class with the waveform fixed at compile time.
+ * 
+ * For LFO's whose waveform never changes.  getValue() is inline and 
+ * non-virtual and reads the waveform table directly, so the class holds 
+ * only its counter and increment (no vtable or wavetable pointer).  It has 
+ * no depth or offset, so the output functions always give the full scale wave.
+ * 
+ * @tparam TICK_RATE_MS - The tick rate in milliseconds (milliseconds between calls to tick())
+ * @tparam WAVEFORM - The oscillator waveform
+ * @tparam WAVEFORMS - The waveform table class (EightBitWaveforms, EightBitDeltaWaveforms or a QuarterWaveSine)
+ * @tparam INTERPOLATION - The interpolation policy (TruncatingInterpolation, LinearInterpolation or HermiteInterpolation)
+ */
+template <unsigned long TICK_RATE_MS, LFOWaveform WAVEFORM = LFOWaveform::Sine, class WAVEFORMS = EightBitWaveforms, 
+          class INTERPOLATION = LinearInterpolation>
+class StaticLFO: public LFOCounter, public LFOCalculator<TICK_RATE_MS, LFOCounter::PhaseBitDepth>
+{
+    public:
+        /**
+         * @brief The oscillator waveform
+         */
+        static constexpr LFOWaveform Waveform = WAVEFORM;
+
+        inline void setPeriod(float periodSeconds)
+        {
+            setPhaseIncrement(this->getIncrementValueForPeriod(periodSeconds));
+        }
+
+        inline void setFrequency(float freqHertz)
+        {
+            setPhaseIncrement(this->getIncrementValueForFrequency(freqHertz));
+        }
+
+        inline void setPeriodMs(uint32_t periodMilliseconds)
+        {
+            setPhaseIncrement(this->getIncrementValueForPeriodMs(periodMilliseconds));
+        }
+
+        inline void setFrequencyMilliHz(uint32_t freqMilliHertz)
+        {
+            setPhaseIncrement(this->getIncrementValueForFrequencyMilliHz(freqMilliHertz));
+        }
+
+        /**
+         * @brief Set the frequency on an exponential scale (integer only, see BasicLFOCalculator::getIncrementValueForOctave())
+         * 
+         * @param octaves The frequency in octaves relative to 1 Hz, with 16 fraction bits (65536 per octave)
+         */
+        inline void setFrequencyExp(int32_t octaves)
+        {
+            setPhaseIncrement(this->getIncrementValueForOctave(octaves));
+        }
+
+        /**
+         * @brief Get the oscillators output value
+         * 
+         * @return uint32_t The oscillators 24 bit output 
+         */
+        inline uint32_t getValue() const
+        {
+            return INTERPOLATION::template interpolate<WAVEFORMS>(WAVEFORMS::getTable(WAVEFORM), counter);
+        }
+
+        /**
+         * @brief Render a block of output values (see BaseLFO::render())
+         * 
+         * @param out Buffer receiving the 24 bit output values
+         * @param n The number of values to render
+         */
+        inline void render(uint32_t *out, size_t n)
+        {
+            renderTable<WAVEFORMS, INTERPOLATION>(WAVEFORMS::getTable(WAVEFORM), out, n);
+        }
+
+        /**
+         * @brief Tick the oscillator and render a block of output values (see BaseLFO::tickAndRender())
+         * 
+         * @param out Buffer receiving the 24 bit output values
+         * @param n The number of values to render
+         */
+        inline void tickAndRender(uint32_t *out, size_t n)
+        {
+            tickAndRenderTable<WAVEFORMS, INTERPOLATION>(WAVEFORMS::getTable(WAVEFORM), out, n);
+        }
+
+        /**
+         * @brief Get the output value in a DAC/PWM format, rounded to the nearest level (see BaseLFO::getOutput())
+         * 
+         * @tparam FORMAT The output format (such as LFOOutput10Bit or LFOOutputSigned16Bit)
+         * @return FORMAT::Sample The output sample
+         */
+        template <class FORMAT>
+        inline typename FORMAT::Sample getOutput() const
+        {
+            LFONoDither dither;
+            return getOutput<FORMAT>(dither);
+        }
+
+        /**
+         * @brief Get the output value in a DAC/PWM format, dithered
+         * 
+         * @tparam FORMAT The output format (such as LFOOutput10Bit or LFOOutputSigned16Bit)
+         * @tparam DITHER The dither class (LFONoDither, LFOTPDFDither or LFONoiseShapedDither)
+         * @param dither The dither state (keep one per output)
+         * @return FORMAT::Sample The output sample
+         */
+        template <class FORMAT, class DITHER>
+        inline typename FORMAT::Sample getOutput(DITHER &dither) const
+        {
+            return FORMAT::convert(dither.template quantize<FORMAT>(getValue()));
+        }
+
+        /**
+         * @brief Render a block of output samples in a DAC/PWM format (see render())
+         * 
+         * @tparam FORMAT The output format (such as LFOOutput10Bit or LFOOutputSigned16Bit)
+         * @param out Buffer receiving the output samples
+         * @param n The number of samples to render
+         */
+        template <class FORMAT>
+        inline void renderOutput(typename FORMAT::Sample *out, size_t n)
+        {
+            LFONoDither dither;
+            renderOutput<FORMAT>(out, n, dither);
+        }
+
+        /**
+         * @brief Render a block of dithered output samples in a DAC/PWM format (see render())
+         * 
+         * @tparam FORMAT The output format (such as LFOOutput10Bit or LFOOutputSigned16Bit)
+         * @tparam DITHER The dither class (LFONoDither, LFOTPDFDither or LFONoiseShapedDither)
+         * @param out Buffer receiving the output samples
+         * @param n The number of samples to render
+         * @param dither The dither state (keep one per output)
+         */
+        template <class FORMAT, class DITHER>
+        inline void renderOutput(typename FORMAT::Sample *out, size_t n, DITHER &dither)
+        {
+            const LFOScaling unscaled;
+            renderTableOutput<WAVEFORMS, INTERPOLATION, FORMAT>(WAVEFORMS::getTable(WAVEFORM), unscaled, out, n, dither);
+        }
+
+        /**
+         * @brief Tick and render a block of output samples in a DAC/PWM format (see tickAndRender())
+         * 
+         * @tparam FORMAT The output format (such as LFOOutput10Bit or LFOOutputSigned16Bit)
+         * @param out Buffer receiving the output samples
+         * @param n The number of samples to render
+         */
+        template <class FORMAT>
+        inline void tickAndRenderOutput(typename FORMAT::Sample *out, size_t n)
+        {
+            LFONoDither dither;
+            tickAndRenderOutput<FORMAT>(out, n, dither);
+        }
+
+        /**
+         * @brief Tick and render a block of dithered output samples in a DAC/PWM format (see tickAndRender())
+         * 
+         * @tparam FORMAT The output format (such as LFOOutput10Bit or LFOOutputSigned16Bit)
+         * @tparam DITHER The dither class (LFONoDither, LFOTPDFDither or LFONoiseShapedDither)
+         * @param out Buffer receiving the output samples
+         * @param n The number of samples to render
+         * @param dither The dither state (keep one per output)
+         */
+        template <class FORMAT, class DITHER>
+        inline void tickAndRenderOutput(typename FORMAT::Sample *out, size_t n, DITHER &dither)
+        {
+            const LFOScaling unscaled;
+            tickAndRenderTableOutput<WAVEFORMS, INTERPOLATION, FORMAT>(WAVEFORMS::getTable(WAVEFORM), unscaled, out, n, dither);
+        }
+};
+
+#endif
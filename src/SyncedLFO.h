@@ -0,0 +1,313 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file SyncedLFO.h 
+//!  @brief SyncedLFO class definition (phase synchronization to a shared time base)
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#ifndef _SYNCED_LFO_H_
+#define _SYNCED_LFO_H_
+
+#include <Arduino.h>
+
+/**
+ * @brief Software LFO which keeps its phase locked to a time base shared by several boards
+ * 
+ * setPhaseFromTime() sets the phase once, but each board then ticks from its 
+ * own clock, and clocks that differ by a few hundred ppm drift apart.  Call 
+ * syncToTime() whenever the shared time is received (for example from a 
+ * sync message every second).  It compares the phase with the reference 
+ * phase for that time and nudges the increment, instead of jumping:
+ * 
+ * - The phase error is corrected over the next sync interval.
+ * - The increment is trimmed by the learned clock skew, so the error does 
+ *   not build up again between syncs.
+ * 
+ * The skew is measured from how much phase the LFO had to gain over a long 
+ * baseline (2^gainShift to 2^(gainShift + 1) syncs, see setSyncGain()).  The 
+ * phase is only known to within a tick, so a single sync interval of 1000 
+ * ticks can not resolve the skew better than 1000 ppm, while the baseline 
+ * average is accurate to about (2 + 2 * jitter) ticks over the baseline 
+ * length.  With a sync every 1000 ticks and the default gain of 7 that is 
+ * 16 ppm without jitter.
+ * 
+ * The first syncToTime() (or one after resetSync()) jumps to the reference 
+ * phase.  The learned skew is a ratio, so it is kept when the frequency 
+ * changes.  The frequency must be set through the SyncedLFO itself (not a 
+ * BaseLFO pointer), and glides are not followed.
+ * 
+ *     SyncedLFO<SoftwareLFO<1>> LFO;
+ *     LFO.setFrequency(0.5f);
+ *     LFO.syncToTime(message.ticks); //On every sync message
+ * 
+ * @tparam LFO - The LFO class (SoftwareLFO, DeluxeSoftwareLFO or a variant)
+ */
+template <class LFO>
+class SyncedLFO: public LFO
+{
+    public:
+        /**
+         * @brief Number of fraction bits of the learned clock skew
+         */
+        static constexpr unsigned int SkewBits = 31;
+
+        /**
+         * @brief Construct a new SyncedLFO object (not yet synchronized)
+         */
+        SyncedLFO(): nominal_increment(0), skew(0), last_sync(0), last_error(0), 
+                     skew_sum(0), skew_ticks(0), skew_syncs(0), gain_shift(7), synced(false), measuring(false){}
+
+        inline void setPhaseIncrement(uint32_t value)
+        {
+            LFO::setPhaseIncrement(value);
+            applyNominal();
+        }
+
+        inline void setIncrementValue(uint32_t value)
+        {
+            LFO::setIncrementValue(value);
+            applyNominal();
+        }
+
+        inline void setPeriod(float periodSeconds)
+        {
+            LFO::setPeriod(periodSeconds);
+            applyNominal();
+        }
+
+        inline void setFrequency(float freqHertz)
+        {
+            LFO::setFrequency(freqHertz);
+            applyNominal();
+        }
+
+        inline void setPeriodMs(uint32_t periodMilliseconds)
+        {
+            LFO::setPeriodMs(periodMilliseconds);
+            applyNominal();
+        }
+
+        inline void setFrequencyMilliHz(uint32_t freqMilliHertz)
+        {
+            LFO::setFrequencyMilliHz(freqMilliHertz);
+            applyNominal();
+        }
+
+        inline void setFrequencyExp(int32_t octaves)
+        {
+            LFO::setFrequencyExp(octaves);
+            applyNominal();
+        }
+
+        /**
+         * @brief Get the phase increment set by the frequency functions (before skew correction)
+         * 
+         * @return uint32_t The nominal 32 bit phase increment
+         */
+        uint32_t getNominalIncrement() const { return nominal_increment; }
+
+        /**
+         * @brief Get the learned clock skew
+         * 
+         * @return int32_t The skew as a fraction of the nominal increment, with SkewBits fraction bits
+         */
+        int32_t getSkew() const { return skew; }
+
+        /**
+         * @brief Check if syncToTime() has set the phase since construction or resetSync()
+         * 
+         * @return true If the phase is being locked to the shared time base
+         */
+        bool isSynced() const { return synced; }
+
+        /**
+         * @brief Set how many syncs the clock skew is averaged over
+         * 
+         * A longer baseline is more accurate but follows changes of the clock 
+         * (for example with temperature) more slowly.
+         * 
+         * @param gainShift The skew is averaged over 2^gainShift to 2^(gainShift + 1) syncs (0 trusts each sync)
+         */
+        void setSyncGain(uint8_t gainShift) { gain_shift = (gainShift > 16) ? 16 : gainShift; }
+
+        /**
+         * @brief Forget the learned skew, so the next syncToTime() jumps to the reference phase
+         */
+        void resetSync()
+        {
+            synced = false;
+            skew = 0;
+            restartBaseline();
+            this->tick_increment = nominal_increment;
+        }
+
+        /**
+         * @brief Set the phase from a shared time base, at the nominal increment (see LFOCounter::setPhaseFromTime())
+         * 
+         * @param epochTicks The number of ticks since the shared epoch
+         * @param phaseAtEpoch The 32 bit phase at the epoch
+         */
+        inline void setPhaseFromTime(uint64_t epochTicks, uint32_t phaseAtEpoch = 0)
+        {
+            this->counter = phaseAtEpoch + static_cast<uint32_t>(epochTicks) * nominal_increment;
+        }
+
+        /**
+         * @brief Steer the phase towards the reference phase of the shared time base
+         * 
+         * @param epochTicks The number of ticks since the shared epoch (in nominal ticks of the shared clock)
+         * @param phaseAtEpoch The 32 bit phase at the epoch
+         * @return int32_t The phase error before the correction (reference minus local phase, 2^32 is one period)
+         */
+        int32_t syncToTime(uint64_t epochTicks, uint32_t phaseAtEpoch = 0)
+        {
+            const uint32_t reference = phaseAtEpoch + static_cast<uint32_t>(epochTicks) * nominal_increment;
+            const int32_t error = static_cast<int32_t>(reference - this->counter);
+            const uint32_t interval = static_cast<uint32_t>(epochTicks) - last_sync;
+            last_sync = static_cast<uint32_t>(epochTicks);
+            if (!synced || (interval == 0) || (interval > 0x7FFFFFFFUL))
+            {
+                this->counter = reference;
+                this->tick_increment = skewedIncrement();
+                synced = true;
+                restartBaseline();
+                return error;
+            }
+            if (measuring && (nominal_increment != 0))
+            {
+                //Phase gained over the nominal increment in this interval: what the increment added plus the error change
+                const int64_t gained = static_cast<int64_t>(static_cast<int32_t>(this->tick_increment - nominal_increment)) * interval +
+                                       (static_cast<int64_t>(error) - last_error);
+                measure(gained, interval);
+            }
+            measuring = true;
+            last_error = error;
+            const int32_t correction = error / static_cast<int32_t>(interval);
+            //Remove the phase error over the next interval
+            this->tick_increment = skewedIncrement() + static_cast<uint32_t>(correction);
+            return error;
+        }
+
+    protected:
+        /**
+         * @brief Take the increment just set as the nominal one and apply the skew to it
+         */
+        inline void applyNominal()
+        {
+            nominal_increment = this->tick_increment;
+            this->tick_increment = skewedIncrement();
+            //The interval running now had another increment, so it is not measured
+            measuring = false;
+        }
+
+        /**
+         * @brief Start a new skew baseline (the learned skew is kept until the next measurement)
+         */
+        inline void restartBaseline()
+        {
+            skew_sum = 0;
+            skew_ticks = 0;
+            skew_syncs = 0;
+            last_error = 0;
+            measuring = true;
+        }
+
+        /**
+         * @brief Add one sync interval to the baseline and update the skew to its average
+         * 
+         * @param gained The phase gained over the nominal increment during the interval
+         * @param interval The length of the interval in ticks
+         */
+        void measure(int64_t gained, uint32_t interval)
+        {
+            //Skew times the interval with 16 fraction bits, limited to a skew of +/- 0.5
+            const int64_t limit = static_cast<int64_t>(interval) << 15;
+            const int64_t clamped = (gained > (1LL << 46)) ? (1LL << 46) : ((gained < -(1LL << 46)) ? -(1LL << 46) : gained);
+            int64_t skewTicks = (clamped * 65536) / static_cast<int64_t>(nominal_increment);
+            skewTicks = (skewTicks > limit) ? limit : ((skewTicks < -limit) ? -limit : skewTicks);
+            //Keep the baseline between 2^gain_shift and 2^(gain_shift + 1) syncs by halving the older ones
+            if ((skew_syncs >= (2UL << gain_shift)) || (skew_ticks > 0x3FFFFFFFUL - interval))
+            {
+                skew_sum /= 2;
+                skew_ticks /= 2;
+                skew_syncs /= 2;
+            }
+            skew_sum += skewTicks;
+            skew_ticks += interval;
+            skew_syncs++;
+            const int64_t average = (skew_sum * (1LL << (SkewBits - 16))) / static_cast<int64_t>(skew_ticks);
+            skew = (average > 0x3FFFFFFFLL) ? 0x3FFFFFFF : ((average < -0x3FFFFFFFLL) ? -0x3FFFFFFF : static_cast<int32_t>(average));
+        }
+
+        /**
+         * @brief The nominal increment corrected by the learned skew
+         */
+        inline uint32_t skewedIncrement() const
+        {
+            return nominal_increment + static_cast<uint32_t>(static_cast<int32_t>((static_cast<int64_t>(nominal_increment) * skew) / (1LL << SkewBits)));
+        }
+
+        uint32_t nominal_increment;     //!< The increment set by the frequency functions
+        int32_t skew;                   //!< The learned clock skew, with SkewBits fraction bits
+        uint32_t last_sync;             //!< Tick count of the last syncToTime() (lower 32 bits)
+        int32_t last_error;             //!< The phase error at the last syncToTime()
+        int64_t skew_sum;               //!< Skew times ticks over the baseline, with 16 fraction bits
+        uint32_t skew_ticks;            //!< The number of ticks in the baseline
+        uint32_t skew_syncs;            //!< The number of sync intervals in the baseline
+        uint8_t gain_shift;             //!< The baseline holds 2^gain_shift to 2^(gain_shift + 1) syncs
+        bool synced;                    //!< Whether the phase has been set by syncToTime()
+        bool measuring;                 //!< Whether the interval since the last syncToTime() can be measured
+};
+
+#endif
@@ -0,0 +1,227 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file EightBitDeltaWaveforms.h 
+//!  @brief Definitions for 8-bit (value, slope) LFO waveforms
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#ifndef _EIGHT_BIT_DELTA_WAVEFORMS_H_
+#define _EIGHT_BIT_DELTA_WAVEFORMS_H_
+
+#include <Arduino.h>
+#include "EightBitWaveforms.h"
+#include "WaveformGenerator.h"
+
+/**
+ * @brief A single (value, slope) table entry of EightBitDeltaWaveforms
+ */
+struct EightBitDeltaPoint
+{
+    int16_t value;  //!< The table value
+    int16_t slope;  //!< The difference between the next table value and this one
+};
+
+/**
+ * @brief Shape adapter producing (value, slope) points from an 8-bit shape
+ * 
+ * @tparam SHAPE - The 8-bit waveform shape
+ */
+template <class SHAPE>
+struct EightBitDeltaShape
+{
+    static constexpr EightBitDeltaPoint sample(unsigned int index)
+    {
+        return EightBitDeltaPoint{static_cast<int16_t>(SHAPE::sample(index)), 
+                                  static_cast<int16_t>(static_cast<int16_t>(SHAPE::sample(index + 1)) - static_cast<int16_t>(SHAPE::sample(index)))};
+    }
+};
+
+/**
+ * @brief Static class providing eight bit lookup tables stored as interleaved (value, slope) pairs
+ * 
+ * Each entry holds a table value together with the difference to the next value, 
+ * so interpolation needs one load and one multiply-add instead of two loads and 
+ * a subtraction.  The output is identical to EightBitWaveforms, at four times 
+ * the table size (1 KiB per waveform), so these tables suit targets with plenty 
+ * of memory rather than small AVR boards.
+ * 
+ */
+class EightBitDeltaWaveforms
+{
+    public:
+        EightBitDeltaWaveforms() = delete; //!< Unconstructable class
+
+        /**
+         * @brief A single table entry
+         */
+        typedef EightBitDeltaPoint Point;
+
+        /**
+         * @brief Type of a waveform table
+         */
+        typedef const Point *Table;
+
+        /**
+         * @brief Size of a waveform table.
+         * 
+         * No extra interpolation entry is needed since each entry stores its slope
+         */
+        static constexpr unsigned int TableSize = 256;
+
+        /**
+         * @brief Bit depth of the table values
+         */
+        static constexpr unsigned int SampleBits = 8;
+
+        /**
+         * @brief Number of phase bits used to index the table
+         */
+        static constexpr unsigned int IndexBits = 8;
+
+        /**
+         * @brief Alignment of the tables (one cache line)
+         */
+        static constexpr unsigned int TableAlignment = 64;
+
+        /**
+         * @brief Type of the waveform table storage
+         */
+        typedef WaveformArray<Point, TableSize> Array;
+
+        /**
+         * @brief The sine table 
+         * 
+         */
+        alignas(TableAlignment) static constexpr Array sine = WaveformGenerator::generate<EightBitDeltaShape<SineShape<8, TableSize>>, Point, TableSize>();
+
+        /**
+         * @brief The triangle table 
+         * 
+         */
+        alignas(TableAlignment) static constexpr Array triangle = WaveformGenerator::generate<EightBitDeltaShape<TriangleShape<8, TableSize>>, Point, TableSize>();
+
+        /**
+         * @brief The square table 
+         * 
+         */
+        alignas(TableAlignment) static constexpr Array square = WaveformGenerator::generate<EightBitDeltaShape<SquareShape<8, TableSize>>, Point, TableSize>();
+
+        /**
+         * @brief The Sawtooth table 
+         * 
+         */
+        alignas(TableAlignment) static constexpr Array sawtooth = WaveformGenerator::generate<EightBitDeltaShape<SawtoothShape<8, TableSize>>, Point, TableSize>();
+
+        /**
+         * @brief The AsymmetricSine table 
+         * 
+         */
+        alignas(TableAlignment) static constexpr Array asymSine = WaveformGenerator::generate<EightBitDeltaShape<AsymmetricSineShape<8, TableSize>>, Point, TableSize>();
+
+        /**
+         * @brief The InvertedAsymmetricSine table 
+         * 
+         */
+        alignas(TableAlignment) static constexpr Array invertedAsymSine = WaveformGenerator::generate<EightBitDeltaShape<InvertedAsymmetricSineShape<8, TableSize>>, Point, TableSize>();
+
+        /**
+         * @brief The CompoundSine table 
+         * 
+         */
+        alignas(TableAlignment) static constexpr Array compoundSine = WaveformGenerator::generate<EightBitDeltaShape<CompoundSineShape<8, TableSize>>, Point, TableSize>();
+
+        /**
+         * @brief Get the table for the supplied waveform
+         * 
+         * @param waveform - The desired waveform
+         * @return Table The waveform's table (sine if the waveform is invalid)
+         */
+        static constexpr Table getTable(LFOWaveform waveform)
+        {
+            return (waveform == LFOWaveform::Triangle) ? triangle :
+                   (waveform == LFOWaveform::Square) ? square :
+                   (waveform == LFOWaveform::Sawtooth) ? sawtooth :
+                   (waveform == LFOWaveform::AsymmetricSine) ? asymSine :
+                   (waveform == LFOWaveform::InvertedAsymmetricSine) ? invertedAsymSine :
+                   (waveform == LFOWaveform::CompoundSine) ? compoundSine :
+                   sine;
+        }
+
+        /**
+         * @brief Get a table value
+         * 
+         * @param table - The waveform table to read from
+         * @param index - The table index (wraps around every 256 entries)
+         * @return uint32_t The table value
+         */
+        static inline uint32_t getSample(Table table, uint32_t index)
+        {
+            return static_cast<uint32_t>(table[index & 0xFF].value);
+        }
+
+        /**
+         * @brief Get the linearly interpolated value of a table
+         * 
+         * @param table - The waveform table to read from
+         * @param phase - The 32 bit oscillator phase
+         * @return uint32_t The 24 bit interpolated value
+         */
+        static inline uint32_t interpolate(Table table, uint32_t phase)
+        {
+            const Point &point = table[phase >> 24];
+            int32_t i = static_cast<int32_t>((phase >> 8) & 0xFFFF);
+            return static_cast<uint32_t>((static_cast<int32_t>(point.value) << 16) + point.slope * i);
+        }
+};
+
+#endif
@@ -57,390 +57,19 @@
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 #include "EightBitWaveforms.h"
 
-const uint8_t EightBitWaveforms::sine[TableSize] = {
-    0x80, 0x83, 0x86, 0x89, 0x8C, 0x90, 0x93, 0x96,
-    0x99, 0x9C, 0x9F, 0xA2, 0xA5, 0xA8, 0xAB, 0xAE,
-    0xB1, 0xB3, 0xB6, 0xB9, 0xBC, 0xBF, 0xC1, 0xC4,
-    0xC7, 0xC9, 0xCC, 0xCE, 0xD1, 0xD3, 0xD5, 0xD8,
-    0xDA, 0xDC, 0xDE, 0xE0, 0xE2, 0xE4, 0xE6, 0xE8,
-    0xEA, 0xEB, 0xED, 0xEF, 0xF0, 0xF1, 0xF3, 0xF4,
-    0xF5, 0xF6, 0xF8, 0xF9, 0xFA, 0xFA, 0xFB, 0xFC,
-    0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFD,
-    0xFD, 0xFC, 0xFB, 0xFA, 0xFA, 0xF9, 0xF8, 0xF6,
-    0xF5, 0xF4, 0xF3, 0xF1, 0xF0, 0xEF, 0xED, 0xEB,
-    0xEA, 0xE8, 0xE6, 0xE4, 0xE2, 0xE0, 0xDE, 0xDC,
-    0xDA, 0xD8, 0xD5, 0xD3, 0xD1, 0xCE, 0xCC, 0xC9,
-    0xC7, 0xC4, 0xC1, 0xBF, 0xBC, 0xB9, 0xB6, 0xB3,
-    0xB1, 0xAE, 0xAB, 0xA8, 0xA5, 0xA2, 0x9F, 0x9C,
-    0x99, 0x96, 0x93, 0x90, 0x8C, 0x89, 0x86, 0x83,
-    0x80, 0x7D, 0x7A, 0x77, 0x74, 0x70, 0x6D, 0x6A,
-    0x67, 0x64, 0x61, 0x5E, 0x5B, 0x58, 0x55, 0x52,
-    0x4F, 0x4D, 0x4A, 0x47, 0x44, 0x41, 0x3F, 0x3C,
-    0x39, 0x37, 0x34, 0x32, 0x2F, 0x2D, 0x2B, 0x28,
-    0x26, 0x24, 0x22, 0x20, 0x1E, 0x1C, 0x1A, 0x18,
-    0x16, 0x15, 0x13, 0x11, 0x10, 0x0F, 0x0D, 0x0C,
-    0x0B, 0x0A, 0x08, 0x07, 0x06, 0x06, 0x05, 0x04,
-    0x03, 0x03, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01,
-    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03,
-    0x03, 0x04, 0x05, 0x06, 0x06, 0x07, 0x08, 0x0A,
-    0x0B, 0x0C, 0x0D, 0x0F, 0x10, 0x11, 0x13, 0x15,
-    0x16, 0x18, 0x1A, 0x1C, 0x1E, 0x20, 0x22, 0x24,
-    0x26, 0x28, 0x2B, 0x2D, 0x2F, 0x32, 0x34, 0x37,
-    0x39, 0x3C, 0x3F, 0x41, 0x44, 0x47, 0x4A, 0x4D,
-    0x4F, 0x52, 0x55, 0x58, 0x5B, 0x5E, 0x61, 0x64,
-    0x67, 0x6A, 0x6D, 0x70, 0x74, 0x77, 0x7A, 0x7D,
-    0x80};
+constexpr EightBitWaveforms::Array EightBitWaveforms::sine;
+constexpr EightBitWaveforms::Array EightBitWaveforms::triangle;
+constexpr EightBitWaveforms::Array EightBitWaveforms::square;
+constexpr EightBitWaveforms::Array EightBitWaveforms::sawtooth;
+constexpr EightBitWaveforms::Array EightBitWaveforms::asymSine;
+constexpr EightBitWaveforms::Array EightBitWaveforms::invertedAsymSine;
+constexpr EightBitWaveforms::Array EightBitWaveforms::compoundSine;
 
-const uint8_t EightBitWaveforms::triangle[TableSize] =
-    {128, 130, 132, 134, 136, 138, 140, 142,
-     144, 146, 148, 150, 152, 154, 156, 158,
-     160, 162, 164, 166, 168, 170, 172, 174,
-     176, 178, 180, 182, 184, 186, 188, 190,
-     192, 194, 196, 198, 200, 202, 204, 206,
-     208, 210, 212, 214, 216, 218, 220, 222,
-     224, 226, 228, 230, 232, 234, 236, 238,
-     240, 242, 244, 246, 248, 250, 252, 254,
-     255, 254, 252, 250, 248, 246, 244, 242,
-     240, 238, 236, 234, 232, 230, 228, 226,
-     224, 222, 220, 218, 216, 214, 212, 210,
-     208, 206, 204, 202, 200, 198, 196, 194,
-     192, 190, 188, 186, 184, 182, 180, 178,
-     176, 174, 172, 170, 168, 166, 164, 162,
-     160, 158, 156, 154, 152, 150, 148, 146,
-     144, 142, 140, 138, 136, 134, 132, 130,
-     128, 126, 124, 122, 120, 118, 116, 114,
-     112, 110, 108, 106, 104, 102, 100, 98,
-     96, 94, 92, 90, 88, 86, 84, 82,
-     80, 78, 76, 74, 72, 70, 68, 66,
-     64, 62, 60, 58, 56, 54, 52, 50,
-     48, 46, 44, 42, 40, 38, 36, 34,
-     32, 30, 28, 26, 24, 22, 20, 18,
-     16, 14, 12, 10, 8, 6, 4, 2,
-     0, 2, 4, 6, 8, 10, 12, 14,
-     16, 18, 20, 22, 24, 26, 28, 30,
-     32, 34, 36, 38, 40, 42, 44, 46,
-     48, 50, 52, 54, 56, 58, 60, 62,
-     64, 66, 68, 70, 72, 74, 76, 78,
-     80, 82, 84, 86, 88, 90, 92, 94,
-     96, 98, 100, 102, 104, 106, 108, 110,
-     112, 114, 116, 118, 120, 122, 124, 126,
-     128};
-
-//Sawtooth
-const uint8_t EightBitWaveforms::sawtooth[TableSize]{
-    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
-    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
-    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
-    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
-    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
-    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
-    96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
-    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
-    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
-    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
-    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
-    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
-    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
-    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
-    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
-    240, 241, 242, 243, 244, +245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 0};
-
-//Square
-const uint8_t EightBitWaveforms::square[TableSize]{
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    0,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    255,
-    0
-};
-
-const uint8_t EightBitWaveforms::asymSine[TableSize]{
-    0, 7, 13, 20, 27, 33, 40, 46, 53, 60, 66, 72, 79, 85, 91, 98, 104, 110, 116, 122, 128, 133, 139, 144,
-    150, 155, 160, 166, 171, 176, 180, 185, 190, 194, 198, 202, 206, 210, 214, 217, 221, 224, 227, 230,
-    233, 236, 238, 240, 243, 244, 246, 248, 249, 251, 252, 253, 254, 254, 255, 255, 255, 255, 255, 254, 254,
-    253, 252, 251, 249, 248, 246, 244, 243, 240, 238, 236, 233, 230, 227, 224, 221, 217, 214, 210, 206, 202,
-    198, 194, 190, 185, 180, 176, 171, 166, 160, 155, 150, 144, 139, 133, 128, 122, 116, 110, 104, 98, 91, 85,
-    79, 72, 66, 60, 53, 46, 40, 33, 27, 20, 13, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-
-const uint8_t EightBitWaveforms::invertedAsymSine[TableSize]{
-    255, 248, 242, 235, 228, 222, 215, 209, 202, 195, 189, 183, 176, 170, 164, 157, 151, 145, 139, 133,
-    127, 122, 116, 111, 105, 100, 95, 89, 84, 79, 75, 70, 65, 61, 57, 53, 49, 45, 41, 38, 34, 31, 28, 25, 22,
-    19, 17, 15, 12, 11, 9, 7, 6, 4, 3, 2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 2, 3, 4, 6, 7, 9, 11, 12, 15, 17, 19, 22, 25, 28, 31,
-    34, 38, 41, 45, 49, 53, 57, 61, 65, 70, 75, 79, 84, 89, 95, 100, 105, 111, 116, 122, 127, 133, 139, 145, 151,
-    157, 164, 170, 176, 183, 189, 195, 202, 209, 215, 222, 228, 235, 242, 248, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255};
-
-const uint8_t EightBitWaveforms::compoundSine[TableSize]{
-    128, 135, 141, 147, 151, 156, 158, 160, 161, 161, 160, 159, 158, 158, 158, 158, 160, 163, 166, 170, 176,
-    182, 189, 194, 200, 205, 209, 212, 215, 216, 217, 216, 214, 212, 210, 209, 208, 208, 209, 210, 213, 217,
-    220, 226, 230, 236, 240, 244, 248, 250, 250, 250, 250, 248, 244, 241, 239, 235, 233, 231, 230, 231, 232, 234,
-    237, 240, 244, 248, 250, 253, 254, 255, 254, 253, 250, 247, 242, 238, 233, 229, 225, 222, 219, 219, 219, 219,
-    219, 222, 224, 226, 228, 229, 229, 228, 226, 223, 219, 215, 209, 203, 198, 191, 187, 182, 179, 177, 175, 174,
-    175, 176, 177, 178, 179, 179, 178, 177, 174, 169, 165, 159, 153, 147, 140, 134, 128, 124, 120, 117, 115, 114,
-    114, 115, 116, 117, 117, 117, 117, 115, 112, 107, 103, 98, 92, 86, 79, 73, 67, 63, 60, 57, 56, 56, 56, 56, 58, 59,
-    61, 62, 61, 60, 58, 56, 52, 47, 42, 36, 31, 26, 21, 18, 15, 14, 14, 15, 15, 18, 21, 24, 26, 28, 29, 29, 28, 27, 25,
-    22, 17, 14, 9, 5, 3, 0, 0, 0, 1, 4, 6, 10, 15, 18, 23, 26, 28, 30, 31, 31, 30, 28, 26, 24, 21, 19, 17, 17, 17, 19, 22,
-    26, 30, 36, 41, 46, 52, 56, 60, 63, 66, 66, 67, 66, 66, 64, 63, 61, 61, 62, 64, 66, 69, 74, 79, 86, 92, 98, 105,
-    110, 115, 118, 121, 123, 124, 125, 124, 123, 126, 128, 128};
+const uint8_t * const EightBitWaveforms::tables[static_cast<unsigned int>(LFOWaveform::N_WAVEFORMS)] = {
+    EightBitWaveforms::sine,
+    EightBitWaveforms::triangle,
+    EightBitWaveforms::square,
+    EightBitWaveforms::sawtooth,
+    EightBitWaveforms::asymSine,
+    EightBitWaveforms::invertedAsymSine,
+    EightBitWaveforms::compoundSine};
@@ -59,6 +59,7 @@
 #define _EIGHT_BIT_SINEWAVE_H_
 
 #include <Arduino.h>
+#include "WaveformGenerator.h"
 
 /**
  * @brief Available LFO waveform selections 
@@ -80,12 +81,20 @@ enum class LFOWaveform
 /**
  * @brief Static class providing eight bit lookup tables for various waveforms
  * 
+ * The tables are generated at compile time by WaveformGenerator and 
+ * are stored as constant data (no runtime initialization).
+ * 
  */
 class EightBitWaveforms
 {
     public:
         EightBitWaveforms() = delete; //!< Unconstructable class
 
+        /**
+         * @brief Type of a waveform table
+         */
+        typedef const uint8_t *Table;
+
         /**
          * @brief Size of a waveform table.  
          * 
@@ -95,48 +104,89 @@ class EightBitWaveforms
          */
         static constexpr unsigned int TableSize = 257;
 
+        /**
+         * @brief Bit depth of the table samples
+         */
+        static constexpr unsigned int SampleBits = 8;
+
+        /**
+         * @brief Number of phase bits used to index the table
+         */
+        static constexpr unsigned int IndexBits = 8;
+
+
+        /**
+         * @brief Type of the waveform table storage
+         */
+        typedef WaveformArray<uint8_t, TableSize> Array;
 
         /**
          * @brief The sine table 
          * 
          */
-        static const uint8_t sine[TableSize];
+        static constexpr Array sine = WaveformGenerator::generate<SineShape<8, TableSize - 1>, uint8_t, TableSize>();
 
         /**
          * @brief The triangle table 
          * 
          */
-        static const uint8_t triangle[TableSize];
+        static constexpr Array triangle = WaveformGenerator::generate<TriangleShape<8, TableSize - 1>, uint8_t, TableSize>();
 
         /**
          * @brief The square table 
          * 
          */
-        static const uint8_t square[TableSize];
+        static constexpr Array square = WaveformGenerator::generate<SquareShape<8, TableSize - 1>, uint8_t, TableSize>();
 
         /**
          * @brief The Sawtooth table 
          * 
          */
-        static const uint8_t sawtooth[TableSize];
+        static constexpr Array sawtooth = WaveformGenerator::generate<SawtoothShape<8, TableSize - 1>, uint8_t, TableSize>();
 
         /**
          * @brief The AsymmetricSine table 
          * 
          */
-        static const uint8_t asymSine[TableSize];
+        static constexpr Array asymSine = WaveformGenerator::generate<AsymmetricSineShape<8, TableSize - 1>, uint8_t, TableSize>();
 
         /**
          * @brief The InvertedAsymmetricSine table 
          * 
          */
-        static const uint8_t invertedAsymSine[TableSize];
+        static constexpr Array invertedAsymSine = WaveformGenerator::generate<InvertedAsymmetricSineShape<8, TableSize - 1>, uint8_t, TableSize>();
 
         /**
          * @brief The CompoundSine table 
          * 
          */
-        static const uint8_t compoundSine[TableSize];
+        static constexpr Array compoundSine = WaveformGenerator::generate<CompoundSineShape<8, TableSize - 1>, uint8_t, TableSize>();
+
+        /**
+         * @brief All of the waveform tables, indexed by LFOWaveform
+         * 
+         */
+        static const uint8_t * const tables[static_cast<unsigned int>(LFOWaveform::N_WAVEFORMS)];
+
+        /**
+         * @brief Get the table for the supplied waveform
+         * 
+         * This is a constexpr function, so a constant waveform resolves 
+         * directly to the table's address at compile time
+         * 
+         * @param waveform - The desired waveform
+         * @return const uint8_t* The waveform's table (sine if the waveform is invalid)
+         */
+        static constexpr const uint8_t *getTable(LFOWaveform waveform)
+        {
+            return (waveform == LFOWaveform::Triangle) ? triangle :
+                   (waveform == LFOWaveform::Square) ? square :
+                   (waveform == LFOWaveform::Sawtooth) ? sawtooth :
+                   (waveform == LFOWaveform::AsymmetricSine) ? asymSine :
+                   (waveform == LFOWaveform::InvertedAsymmetricSine) ? invertedAsymSine :
+                   (waveform == LFOWaveform::CompoundSine) ? compoundSine :
+                   sine;
+        }
 
         /**
          * @brief Get the 8 bit sine value
@@ -145,6 +195,40 @@ class EightBitWaveforms
          * @return uint8_t The sine value
          */
         static uint8_t getSine(uint8_t index){ return sine[index]; };
+
+        /**
+         * @brief Get a table sample
+         * 
+         * @param table - The waveform table to read from
+         * @param index - The table index (wraps around every 256 entries)
+         * @return uint32_t The sample value
+         */
+        static inline uint32_t getSample(Table table, uint32_t index)
+        {
+            return table[index & 0xFF];
+        }
+
+        /**
+         * @brief Get the linearly interpolated value of a table
+         * 
+         * The upper 8 bits of the 32 bit phase select the table entry 
+         * and the next 16 bits interpolate towards the next entry
+         * 
+         * @param table - The waveform table to read from
+         * @param phase - The 32 bit oscillator phase
+         * @return uint32_t The 24 bit interpolated value
+         */
+        static inline uint32_t interpolate(const uint8_t *table, uint32_t phase)
+        {
+            uint32_t val = phase >> 24;
+            uint32_t i = (phase >> 8) & 0xFFFF;
+            uint32_t x = table[val];
+            uint32_t y = table[val + 1];
+            y = y - x;
+            y = y * i;
+            x = x << 16;
+            return x + y;
+        }
 };
 
 #endif
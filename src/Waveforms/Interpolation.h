@@ -0,0 +1,165 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file Interpolation.h 
+//!  @brief Waveform table interpolation policies
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#ifndef _INTERPOLATION_H_
+#define _INTERPOLATION_H_
+
+#include <Arduino.h>
+
+/**
+ * @brief Interpolation policy reading the nearest table entry below the phase
+ * 
+ * A single table load and no multiplication, for LFO's where speed
+ * matters more than smoothness.  The output steps once per table entry.
+ */
+class TruncatingInterpolation
+{
+    public:
+        TruncatingInterpolation() = delete; //!< Unconstructable class
+
+        /**
+         * @brief Read a table at the supplied phase
+         * 
+         * @tparam WAVEFORMS - The waveform table class
+         * @param table - The waveform table to read from
+         * @param phase - The 32 bit oscillator phase
+         * @return uint32_t The 24 bit output value
+         */
+        template <class WAVEFORMS>
+        static inline uint32_t interpolate(typename WAVEFORMS::Table table, uint32_t phase)
+        {
+            return WAVEFORMS::getSample(table, phase >> (32 - WAVEFORMS::IndexBits)) << (24 - WAVEFORMS::SampleBits);
+        }
+};
+
+/**
+ * @brief Interpolation policy drawing a straight line between neighbouring table entries
+ * 
+ * The default policy.  Uses each table class's own interpolate() function.
+ */
+class LinearInterpolation
+{
+    public:
+        LinearInterpolation() = delete; //!< Unconstructable class
+
+        /**
+         * @brief Read a table at the supplied phase
+         * 
+         * @tparam WAVEFORMS - The waveform table class
+         * @param table - The waveform table to read from
+         * @param phase - The 32 bit oscillator phase
+         * @return uint32_t The 24 bit output value
+         */
+        template <class WAVEFORMS>
+        static inline uint32_t interpolate(typename WAVEFORMS::Table table, uint32_t phase)
+        {
+            return WAVEFORMS::interpolate(table, phase);
+        }
+};
+
+/**
+ * @brief Interpolation policy fitting a 4-point cubic Hermite (Catmull-Rom) curve between table entries
+ * 
+ * The output and its slope are continuous across table entries, which removes 
+ * the corners of linear interpolation (audible as a buzz when modulating pitch).  
+ * Needs four table loads and 64 bit arithmetic.  Curves can overshoot at sharp 
+ * edges (square wave), so the output is clamped to the 24 bit range.
+ * 
+ * On 8-bit tables the curve follows the rounding steps of the samples, so it 
+ * trades accuracy for the continuous slope: its largest error is slightly 
+ * above linear interpolation's (34635 vs 32699 LSB on the sine), while its 
+ * largest slope change drops from 256 to 4 LSB.  Tables of more than 8 bits 
+ * get both the accuracy and the smoothness.
+ */
+class HermiteInterpolation
+{
+    public:
+        HermiteInterpolation() = delete; //!< Unconstructable class
+
+        /**
+         * @brief Read a table at the supplied phase
+         * 
+         * @tparam WAVEFORMS - The waveform table class
+         * @param table - The waveform table to read from
+         * @param phase - The 32 bit oscillator phase
+         * @return uint32_t The 24 bit output value
+         */
+        template <class WAVEFORMS>
+        static inline uint32_t interpolate(typename WAVEFORMS::Table table, uint32_t phase)
+        {
+            const unsigned int shift = 16 - WAVEFORMS::SampleBits;
+            uint32_t index = phase >> (32 - WAVEFORMS::IndexBits);
+            int64_t t = static_cast<int64_t>((phase << WAVEFORMS::IndexBits) >> 16);
+            //Samples scaled to 16 bits
+            int64_t p0 = static_cast<int64_t>(WAVEFORMS::getSample(table, index - 1) << shift);
+            int64_t p1 = static_cast<int64_t>(WAVEFORMS::getSample(table, index) << shift);
+            int64_t p2 = static_cast<int64_t>(WAVEFORMS::getSample(table, index + 1) << shift);
+            int64_t p3 = static_cast<int64_t>(WAVEFORMS::getSample(table, index + 2) << shift);
+            //Polynomial coefficients (times two)
+            int64_t c1 = p2 - p0;
+            int64_t c2 = 2 * p0 - 5 * p1 + 4 * p2 - p3;
+            int64_t c3 = 3 * (p1 - p2) + p3 - p0;
+            //Horner's method, keeping 16 fraction bits until the final step
+            int64_t y = c3 * t;
+            y = ((y + c2 * 65536) * t) >> 16;
+            y = ((y + c1 * 65536) * t) >> 24;
+            y = (p1 * 256 + (y >> 1));
+            return (y < 0) ? 0 : ((y > 0xFFFFFF) ? 0xFFFFFF : static_cast<uint32_t>(y));
+        }
+};
+
+#endif
@@ -0,0 +1,187 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file QuarterWaveSine.h 
+//!  @brief Quarter-wave symmetric sine tables
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#ifndef _QUARTER_WAVE_SINE_H_
+#define _QUARTER_WAVE_SINE_H_
+
+#include <Arduino.h>
+#include "EightBitWaveforms.h"
+#include "WaveformGenerator.h"
+
+/**
+ * @brief Static class providing a sine wave from a quarter-wave table
+ * 
+ * Only the first quarter of the cycle (plus the peak) is stored.  The rest
+ * of the cycle is reconstructed by mirroring the index (second quarter) and 
+ * reflecting the value about the center (second half), which needs four 
+ * times less memory than a full cycle table.
+ * 
+ * The class provides the same interface as EightBitWaveforms, but only 
+ * contains a sine wave: getTable() returns the sine for every waveform.
+ * 
+ * @tparam SAMPLE - The table sample type (uint8_t or uint16_t)
+ * @tparam TABLE_SIZE - The number of points in a full cycle (a power of two)
+ */
+template <typename SAMPLE, unsigned int TABLE_SIZE>
+class QuarterWaveSine
+{
+    private:
+        static constexpr unsigned int log2(unsigned int value)
+        {
+            return (value <= 1) ? 0 : 1 + log2(value >> 1);
+        }
+
+    public:
+        QuarterWaveSine() = delete; //!< Unconstructable class
+
+        /**
+         * @brief Type of a waveform table
+         */
+        typedef const SAMPLE *Table;
+
+        /**
+         * @brief Number of points in a full cycle
+         */
+        static constexpr unsigned int TableSize = TABLE_SIZE;
+
+        /**
+         * @brief Number of stored points (a quarter cycle including the peak)
+         */
+        static constexpr unsigned int QuarterTableSize = TABLE_SIZE / 4 + 1;
+
+        /**
+         * @brief Bit depth of the table samples
+         */
+        static constexpr unsigned int SampleBits = 8 * sizeof(SAMPLE);
+
+        /**
+         * @brief Number of phase bits used to index the table
+         */
+        static constexpr unsigned int IndexBits = log2(TABLE_SIZE);
+
+        /**
+         * @brief The quarter-wave table
+         * 
+         * Values follow round(2^(SampleBits-1) + (2^(SampleBits-1) - 1) * sin(x)), 
+         * generated at compile time
+         */
+        static constexpr WaveformArray<SAMPLE, QuarterTableSize> quarter = 
+            WaveformGenerator::generate<SineShape<SampleBits, TABLE_SIZE>, SAMPLE, QuarterTableSize>();
+
+        /**
+         * @brief Get the table for the supplied waveform
+         * 
+         * The waveform is ignored, this class only provides a sine wave
+         * 
+         * @return Table The quarter-wave sine table
+         */
+        static constexpr Table getTable(LFOWaveform)
+        {
+            return quarter;
+        }
+
+        /**
+         * @brief Get a full cycle sample from the quarter-wave table
+         * 
+         * @param table - The quarter-wave table
+         * @param index - The full cycle index (wraps around at TableSize)
+         * @return uint32_t The sample value
+         */
+        static inline uint32_t getSample(Table table, uint32_t index)
+        {
+            const uint32_t half = TABLE_SIZE / 2;
+            uint32_t i = index & (half - 1);
+            //Mirror the second quarter of each half (mask is all ones when mirroring)
+            uint32_t mirror = 0UL - static_cast<uint32_t>(i > TABLE_SIZE / 4);
+            i = (i & ~mirror) | ((half - i) & mirror);
+            uint32_t value = table[i];
+            //Reflect the second half about the center value
+            uint32_t reflect = 0UL - ((index / half) & 1);
+            return (value & ~reflect) | (((1UL << SampleBits) - value) & reflect);
+        }
+
+        /**
+         * @brief Get the linearly interpolated sine value
+         * 
+         * @param table - The quarter-wave table
+         * @param phase - The 32 bit oscillator phase
+         * @return uint32_t The 24 bit interpolated value
+         */
+        static inline uint32_t interpolate(Table table, uint32_t phase)
+        {
+            uint32_t index = phase >> (32 - IndexBits);
+            int32_t i = static_cast<int32_t>((phase << IndexBits) >> 16);
+            uint32_t x = getSample(table, index);
+            int32_t y = static_cast<int32_t>(getSample(table, index + 1) - x);
+            return (x << (24 - SampleBits)) + static_cast<uint32_t>((y * i) >> (SampleBits - 8));
+        }
+};
+
+template <typename SAMPLE, unsigned int TABLE_SIZE>
+constexpr WaveformArray<SAMPLE, QuarterWaveSine<SAMPLE, TABLE_SIZE>::QuarterTableSize> QuarterWaveSine<SAMPLE, TABLE_SIZE>::quarter;
+
+/**
+ * @brief 8-bit, 256 point quarter-wave sine (65 bytes, identical output to EightBitWaveforms::sine)
+ */
+typedef QuarterWaveSine<uint8_t, 256> EightBitQuarterSine;
+
+/**
+ * @brief 16-bit, 1024 point quarter-wave sine (514 bytes)
+ */
+typedef QuarterWaveSine<uint16_t, 1024> SixteenBitQuarterSine;
+
+#endif
@@ -0,0 +1,469 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file WaveformGenerator.h 
+//!  @brief Compile time waveform table generation
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#ifndef _WAVEFORM_GENERATOR_H_
+#define _WAVEFORM_GENERATOR_H_
+
+#include <Arduino.h>
+
+/**
+ * @brief Compile time list of table indices (used to expand a table initializer)
+ */
+template <unsigned int... INDICES>
+struct WaveformIndices
+{
+};
+
+/**
+ * @brief Joins two index lists, offsetting the second by the length of the first
+ */
+template <class FIRST, class SECOND>
+struct JoinWaveformIndices;
+
+template <unsigned int... FIRST, unsigned int... SECOND>
+struct JoinWaveformIndices<WaveformIndices<FIRST...>, WaveformIndices<SECOND...>>
+{
+    typedef WaveformIndices<FIRST..., (sizeof...(FIRST) + SECOND)...> type;
+};
+
+/**
+ * @brief Builds the index list 0 .. COUNT - 1 (with logarithmic template recursion depth)
+ */
+template <unsigned int COUNT>
+struct MakeWaveformIndices
+{
+    typedef typename JoinWaveformIndices<typename MakeWaveformIndices<COUNT / 2>::type, 
+                                         typename MakeWaveformIndices<COUNT - COUNT / 2>::type>::type type;
+};
+
+template <>
+struct MakeWaveformIndices<0>
+{
+    typedef WaveformIndices<> type;
+};
+
+template <>
+struct MakeWaveformIndices<1>
+{
+    typedef WaveformIndices<0> type;
+};
+
+/**
+ * @brief A fixed size table of samples which can be built at compile time
+ * 
+ * @tparam SAMPLE - The sample type
+ * @tparam SIZE - The number of samples
+ */
+template <typename SAMPLE, unsigned int SIZE>
+struct WaveformArray
+{
+    SAMPLE data[SIZE]; //!< The samples
+
+    /**
+     * @brief Use the array as a plain table pointer
+     */
+    constexpr operator const SAMPLE *() const
+    {
+        return data;
+    }
+};
+
+/**
+ * @brief Static class providing compile time (constexpr) waveform table generation
+ * 
+ * Shapes are classes with a static constexpr sample(index) function returning 
+ * the sample value at each table index.  generate() evaluates the shape for 
+ * every index at compile time, so the resulting tables are plain constant data 
+ * with no runtime initialization.
+ */
+class WaveformGenerator
+{
+    public:
+        WaveformGenerator() = delete; //!< Unconstructable class
+
+        /**
+         * @brief The constant pi
+         */
+        static constexpr double Pi = 3.14159265358979323846;
+
+        /**
+         * @brief The natural logarithm of 2
+         */
+        static constexpr double Ln2 = 0.69314718055994530942;
+
+        /**
+         * @brief Compile time sine function
+         * 
+         * @param cycles - The angle in cycles (1.0 is a full period)
+         * @return double The sine of the angle
+         */
+        static constexpr double sine(double cycles)
+        {
+            return sineSeries(reduce(cycles) * 2 * Pi);
+        }
+
+        /**
+         * @brief Compile time sine of a rational angle, exact where the sine is rational
+         * 
+         * The only rational sines of rational angles are 0, +-1/2 and +-1 (Niven's 
+         * theorem), at multiples of 1/12 of a cycle.  Those are returned exactly, so 
+         * a sample which lies exactly on a half (255 * sine(1, 12) is 127.5) is a 
+         * true tie for round(), while every other sample is irrational and further 
+         * from a half than the error of sine().
+         * 
+         * @param num - The numerator of the angle in cycles
+         * @param den - The denominator of the angle in cycles
+         * @return double The sine of num / den cycles
+         */
+        static constexpr double sine(unsigned long num, unsigned long den)
+        {
+            return ((12ULL * num) % den == 0) ? twelfths(static_cast<unsigned int>(((12ULL * num) / den) % 12)) : 
+                                                sine(static_cast<double>(num) / den);
+        }
+
+        /**
+         * @brief Compile time base 2 exponential function
+         * 
+         * @param x - The exponent (accurate for -1.0 to 1.0)
+         * @return double 2 to the power of x
+         */
+        static constexpr double power2(double x)
+        {
+            return expTerms(x * Ln2, 1.0, 1.0, 1);
+        }
+
+        /**
+         * @brief Round a non-negative value to the nearest integer (halves are rounded up)
+         * 
+         * @param value - The value to round
+         * @return uint32_t The rounded value
+         */
+        static constexpr uint32_t round(double value)
+        {
+            return static_cast<uint32_t>(value + 0.5);
+        }
+
+        /**
+         * @brief Round num / den to the nearest integer in integer math (halves are rounded up)
+         * 
+         * @param num - The numerator
+         * @param den - The denominator
+         * @return uint32_t The rounded quotient
+         */
+        static constexpr uint32_t roundRatio(uint64_t num, uint64_t den)
+        {
+            return static_cast<uint32_t>((2 * num + den) / (2 * den));
+        }
+
+        /**
+         * @brief Generate a table from a shape at compile time
+         * 
+         * @tparam SHAPE - The shape class providing static constexpr sample(index)
+         * @tparam SAMPLE - The sample type of the table
+         * @tparam SIZE - The number of samples in the table
+         * @return WaveformArray<SAMPLE, SIZE> The generated table
+         */
+        template <class SHAPE, typename SAMPLE, unsigned int SIZE>
+        static constexpr WaveformArray<SAMPLE, SIZE> generate()
+        {
+            return build<SHAPE, SAMPLE, SIZE>(typename MakeWaveformIndices<SIZE>::type());
+        }
+
+    private:
+        template <class SHAPE, typename SAMPLE, unsigned int SIZE, unsigned int... INDICES>
+        static constexpr WaveformArray<SAMPLE, SIZE> build(WaveformIndices<INDICES...>)
+        {
+            return WaveformArray<SAMPLE, SIZE>{{ static_cast<SAMPLE>(SHAPE::sample(INDICES))... }};
+        }
+
+        //Sine of k / 12 of a cycle, exact where it is rational
+        static constexpr double twelfths(unsigned int k)
+        {
+            return (k % 6 == 0) ? 0.0 : ((k == 3) ? 1.0 : ((k == 9) ? -1.0 : 
+                   ((k == 1 || k == 5) ? 0.5 : ((k == 7 || k == 11) ? -0.5 : sine(k / 12.0)))));
+        }
+
+        //Reduce an angle in cycles to the range [-0.5, 0.5]
+        static constexpr double reduce(double cycles)
+        {
+            return (cycles > 0.5) ? reduce(cycles - 1.0) : ((cycles < -0.5) ? reduce(cycles + 1.0) : cycles);
+        }
+
+        //Taylor series of sin(x) for |x| <= pi
+        static constexpr double sineSeries(double x)
+        {
+            return sineTerms(x * x, x, x, 1);
+        }
+
+        //Taylor series of e^x for |x| <= 1
+        static constexpr double expTerms(double x, double term, double sum, int n)
+        {
+            return (n > 24) ? sum : expTerms(x, term * x / n, sum + term * x / n, n + 1);
+        }
+
+        static constexpr double sineTerms(double x2, double term, double sum, int n)
+        {
+            return (n > 24) ? sum : sineTerms(x2, term * -x2 / ((2.0 * n) * (2.0 * n + 1.0)), 
+                                              sum + term * -x2 / ((2.0 * n) * (2.0 * n + 1.0)), n + 1);
+        }
+};
+
+/**
+ * @brief Sine wave shape: round(C + (C - 1) * sin(x)) where C is half the sample range
+ * 
+ * @tparam SAMPLE_BITS - The sample bit depth
+ * @tparam POINTS - The number of points per cycle
+ */
+template <unsigned int SAMPLE_BITS, unsigned int POINTS>
+struct SineShape
+{
+    static constexpr uint32_t sample(unsigned int index)
+    {
+        return WaveformGenerator::round((1UL << (SAMPLE_BITS - 1)) + ((1UL << (SAMPLE_BITS - 1)) - 1) * 
+                                        WaveformGenerator::sine(index, POINTS));
+    }
+};
+
+/**
+ * @brief Triangle wave shape starting at the center value and rising first
+ * 
+ * @tparam SAMPLE_BITS - The sample bit depth
+ * @tparam POINTS - The number of points per cycle
+ */
+template <unsigned int SAMPLE_BITS, unsigned int POINTS>
+struct TriangleShape
+{
+    static constexpr uint32_t clamp(uint64_t value)
+    {
+        return (value > (1ULL << SAMPLE_BITS) - 1) ? static_cast<uint32_t>((1ULL << SAMPLE_BITS) - 1) : static_cast<uint32_t>(value);
+    }
+
+    static constexpr uint32_t sample(unsigned int index)
+    {
+        return clamp((index <= POINTS / 4) ? (1ULL << (SAMPLE_BITS - 1)) + (2ULL << SAMPLE_BITS) * index / POINTS :
+                     (index <= 3 * POINTS / 4) ? (1ULL << (SAMPLE_BITS - 1)) + (2ULL << SAMPLE_BITS) * (POINTS / 2) / POINTS - 
+                                                 (2ULL << SAMPLE_BITS) * index / POINTS :
+                     (2ULL << SAMPLE_BITS) * (index - 3 * POINTS / 4) / POINTS);
+    }
+};
+
+/**
+ * @brief Rising sawtooth wave shape
+ * 
+ * @tparam SAMPLE_BITS - The sample bit depth
+ * @tparam POINTS - The number of points per cycle
+ */
+template <unsigned int SAMPLE_BITS, unsigned int POINTS>
+struct SawtoothShape
+{
+    static constexpr uint32_t sample(unsigned int index)
+    {
+        return (index < POINTS) ? static_cast<uint32_t>((static_cast<uint64_t>(index) << SAMPLE_BITS) / POINTS) : 0;
+    }
+};
+
+/**
+ * @brief Square (pulse) wave shape, low at the start of the cycle and high for the last DUTY_PERCENT of it
+ * 
+ * @tparam SAMPLE_BITS - The sample bit depth
+ * @tparam POINTS - The number of points per cycle
+ * @tparam DUTY_PERCENT - The percentage of the cycle spent high
+ */
+template <unsigned int SAMPLE_BITS, unsigned int POINTS, unsigned int DUTY_PERCENT = 50>
+struct SquareShape
+{
+    static_assert(DUTY_PERCENT <= 100, "DUTY_PERCENT must be between 0 and 100");
+
+    static constexpr uint32_t sample(unsigned int index)
+    {
+        return ((index >= POINTS - POINTS * static_cast<unsigned long>(DUTY_PERCENT) / 100) && (index < POINTS)) ? 
+            static_cast<uint32_t>((1ULL << SAMPLE_BITS) - 1) : 0;
+    }
+};
+
+/**
+ * @brief Asymmetric sine shape: a positive half sine over the first 15/32 of the cycle, then zero
+ * 
+ * @tparam SAMPLE_BITS - The sample bit depth
+ * @tparam POINTS - The number of points per cycle
+ */
+template <unsigned int SAMPLE_BITS, unsigned int POINTS>
+struct AsymmetricSineShape
+{
+    static constexpr unsigned int PulsePoints = 15 * POINTS / 32;
+
+    static constexpr uint32_t sample(unsigned int index)
+    {
+        return (index <= PulsePoints) ? 
+            WaveformGenerator::round(((1ULL << SAMPLE_BITS) - 1) * WaveformGenerator::sine(index, 2 * PulsePoints)) : 0;
+    }
+};
+
+/**
+ * @brief Inverted asymmetric sine shape
+ * 
+ * @tparam SAMPLE_BITS - The sample bit depth
+ * @tparam POINTS - The number of points per cycle
+ */
+template <unsigned int SAMPLE_BITS, unsigned int POINTS>
+struct InvertedAsymmetricSineShape
+{
+    static constexpr uint32_t sample(unsigned int index)
+    {
+        return static_cast<uint32_t>((1ULL << SAMPLE_BITS) - 1) - AsymmetricSineShape<SAMPLE_BITS, POINTS>::sample(index);
+    }
+};
+
+/**
+ * @brief Compound sine shape, resampled from its 256 point 8-bit definition
+ * 
+ * The compound sine has no formula: it is the hand drawn 8-bit table of the 
+ * original library (the closest sum of two sines is off by 7 levels), so the 
+ * 257 points stay literal and are the single definition of the shape.  Other 
+ * sizes and bit depths interpolate linearly between them with exact integer 
+ * rounding.
+ * 
+ * @tparam SAMPLE_BITS - The sample bit depth
+ * @tparam POINTS - The number of points per cycle
+ */
+template <unsigned int SAMPLE_BITS, unsigned int POINTS>
+struct CompoundSineShape
+{
+    static constexpr uint32_t sample(unsigned int index)
+    {
+        return WaveformGenerator::roundRatio((static_cast<uint64_t>(point(index * 256ULL / POINTS)) * (POINTS - (index * 256ULL) % POINTS) +
+                                              static_cast<uint64_t>(point(index * 256ULL / POINTS + 1)) * ((index * 256ULL) % POINTS)) * 
+                                             ((1ULL << SAMPLE_BITS) - 1), 
+                                             static_cast<uint64_t>(POINTS) * 255);
+    }
+
+    static constexpr uint8_t point(unsigned long index)
+    {
+        return Points.data[(index > 256) ? 256 : index];
+    }
+
+    /**
+     * @brief The 257 point 8-bit compound sine definition
+     */
+    static constexpr WaveformArray<uint8_t, 257> Points = {{
+        128, 135, 141, 147, 151, 156, 158, 160, 161, 161, 160, 159, 158, 158, 158, 158, 160, 163, 166, 170, 176, 182, 189, 194, 200,
+        205, 209, 212, 215, 216, 217, 216, 214, 212, 210, 209, 208, 208, 209, 210, 213, 217, 220, 226, 230, 236, 240, 244, 248, 250,
+        250, 250, 250, 248, 244, 241, 239, 235, 233, 231, 230, 231, 232, 234, 237, 240, 244, 248, 250, 253, 254, 255, 254, 253, 250,
+        247, 242, 238, 233, 229, 225, 222, 219, 219, 219, 219, 219, 222, 224, 226, 228, 229, 229, 228, 226, 223, 219, 215, 209, 203,
+        198, 191, 187, 182, 179, 177, 175, 174, 175, 176, 177, 178, 179, 179, 178, 177, 174, 169, 165, 159, 153, 147, 140, 134, 128,
+        124, 120, 117, 115, 114, 114, 115, 116, 117, 117, 117, 117, 115, 112, 107, 103, 98, 92, 86, 79, 73, 67, 63, 60, 57,
+        56, 56, 56, 56, 58, 59, 61, 62, 61, 60, 58, 56, 52, 47, 42, 36, 31, 26, 21, 18, 15, 14, 14, 15, 15,
+        18, 21, 24, 26, 28, 29, 29, 28, 27, 25, 22, 17, 14, 9, 5, 3, 0, 0, 0, 1, 4, 6, 10, 15, 18,
+        23, 26, 28, 30, 31, 31, 30, 28, 26, 24, 21, 19, 17, 17, 17, 19, 22, 26, 30, 36, 41, 46, 52, 56, 60,
+        63, 66, 66, 67, 66, 66, 64, 63, 61, 61, 62, 64, 66, 69, 74, 79, 86, 92, 98, 105, 110, 115, 118, 121, 123,
+        124, 125, 124, 123, 126, 128, 128}};
+};
+
+template <unsigned int SAMPLE_BITS, unsigned int POINTS>
+constexpr WaveformArray<uint8_t, 257> CompoundSineShape<SAMPLE_BITS, POINTS>::Points;
+
+/**
+ * @brief Base 2 exponential curve over one octave: round(2^(SAMPLE_BITS - 1) * 2^(index / POINTS))
+ * 
+ * Not a waveform, but the table behind LFOExp2 (the samples run from 
+ * 2^(SAMPLE_BITS - 1) to 2^SAMPLE_BITS)
+ * 
+ * @tparam SAMPLE_BITS - The sample bit depth
+ * @tparam POINTS - The number of points per octave
+ */
+template <unsigned int SAMPLE_BITS, unsigned int POINTS>
+struct Exp2Shape
+{
+    static constexpr uint32_t sample(unsigned int index)
+    {
+        return WaveformGenerator::round((1ULL << (SAMPLE_BITS - 1)) * WaveformGenerator::power2(static_cast<double>(index) / POINTS));
+    }
+};
+
+/**
+ * @brief User defined shape, calculated from a constexpr function
+ * 
+ * The function receives the position in the cycle (0.0 to 1.0) and 
+ * returns the normalized output (0.0 to 1.0), for example:
+ * 
+ *     constexpr double ramp(double x){ return 1.0 - x; }
+ *     static constexpr WaveformArray<uint8_t, 257> rampDown = 
+ *         WaveformGenerator::generate<CustomShape<8, 256, ramp>, uint8_t, 257>();
+ * 
+ * C++11 lambdas cannot be used in constant expressions, so a constexpr 
+ * function (or a shape class with a static constexpr sample() function) 
+ * takes their place.
+ * 
+ * @tparam SAMPLE_BITS - The sample bit depth
+ * @tparam POINTS - The number of points per cycle
+ * @tparam FUNCTION - The constexpr shape function
+ */
+template <unsigned int SAMPLE_BITS, unsigned int POINTS, double (*FUNCTION)(double)>
+struct CustomShape
+{
+    static constexpr double clamp(double value)
+    {
+        return (value < 0.0) ? 0.0 : ((value > 1.0) ? 1.0 : value);
+    }
+
+    static constexpr uint32_t sample(unsigned int index)
+    {
+        return WaveformGenerator::round(clamp(FUNCTION(static_cast<double>(index) / POINTS)) * ((1ULL << SAMPLE_BITS) - 1));
+    }
+};
+
+#endif
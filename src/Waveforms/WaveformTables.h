@@ -0,0 +1,237 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+//!  @file WaveformTables.h 
+//!  @brief Waveform tables with selectable bit depth and size
+//!
+//!  @author Nate Taylor 
+//!
+//!  Contact: nate@rtelectronix.com
+//!  @copyright (C) 2020  Nate Taylor - All Rights Reserved.
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                    MMMMMMMMMMMMMMMMMMMMMM   NNNNNNNNNNNNNNNNNN                          |
+//      |                   MMMMMMMMM    MMMMMMMMMM       NNNNNMNNN                               |
+//      |                   MMMMMMMM:    MMMMMMMMMM       NNNNNNNN                                |
+//      |                  MMMMMMMMMMMMMMMMMMMMMMM       NNNNNNNNN                                |
+//      |                 MMMMMMMMMMMMMMMMMMMMMM         NNNNNNNN                                 |
+//      |                 MMMMMMMM     MMMMMMM          NNNNNNNN                                  |
+//      |                MMMMMMMMM    MMMMMMMM         NNNNNNNNN                                  |
+//      |                MMMMMMMM     MMMMMMM          NNNNNNNN                                   |
+//      |               MMMMMMMM     MMMMMMM          NNNNNNNNN                                   |
+//      |                           MMMMMMMM        NNNNNNNNNN                                    |
+//      |                          MMMMMMMMM       NNNNNNNNNNN                                    |
+//      |                          MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                |
+//      |                        MMMMMMM      E L E C T R O N I X         MMMMMM                  |
+//      |                         MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM                    |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//      |-----------------------------------------------------------------------------------------|
+//      |                                                                                         |
+//      |      [MIT License]                                                                      |
+//      |                                                                                         |
+//      |      Copyright (c) 2020 Nathaniel Taylor                                                |
+//      |                                                                                         |
+//      |      Permission is hereby granted, free of charge, to any person obtaining a copy       |
+//      |      of this software and associated documentation files (the "Software"), to deal      |
+//      |      in the Software without restriction, including without limitation the rights       |
+//      |      to use, copy, modify, merge, publish, distribute, sublicense, and/or sell          |
+//      |      copies of the Software, and to permit persons to whom the Software is              |
+//      |      furnished to do so, subject to the following conditions:                           |
+//      |                                                                                         |
+//      |      The above copyright notice and this permission notice shall be included in all     |
+//      |      copies or substantial portions of the Software.                                    |
+//      |                                                                                         |
+//      |      THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR         |
+//      |      IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,           |
+//      |      FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE        |
+//      |      AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER             |
+//      |      LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,      |
+//      |      OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE      |
+//      |      SOFTWARE.                                                                          |
+//      |                                                                                         |
+//      |-----------------------------------------------------------------------------------------|
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+#ifndef _WAVEFORM_TABLES_H_
+#define _WAVEFORM_TABLES_H_
+
+#include <Arduino.h>
+#include "EightBitWaveforms.h"
+#include "WaveformGenerator.h"
+
+/**
+ * @brief Sample type for a table bit depth (8 and 16 bit tables are supported)
+ */
+template <unsigned int SAMPLE_BITS>
+struct WaveformSample;
+
+template <>
+struct WaveformSample<8>
+{
+    typedef uint8_t type;
+};
+
+template <>
+struct WaveformSample<16>
+{
+    typedef uint16_t type;
+};
+
+/**
+ * @brief Static class providing waveform tables with a selectable bit depth and size
+ * 
+ * Provides the same interface and waveforms as EightBitWaveforms.  The tables 
+ * are generated at compile time by WaveformGenerator, so any configuration 
+ * can be selected without adding data files.  Only the tables of configurations
+ * actually used by the program are placed in memory.
+ * 
+ * WaveformTables<8, 256> produces the same output as EightBitWaveforms.
+ * 
+ * @tparam SAMPLE_BITS - The table sample bit depth (8 or 16)
+ * @tparam TABLE_SIZE - The number of points in a full cycle (a power of two, 256 to 4096)
+ */
+template <unsigned int SAMPLE_BITS, unsigned int TABLE_SIZE>
+class WaveformTables
+{
+    private:
+        static constexpr unsigned int log2(unsigned int value)
+        {
+            return (value <= 1) ? 0 : 1 + log2(value >> 1);
+        }
+
+    public:
+        WaveformTables() = delete; //!< Unconstructable class
+
+        /**
+         * @brief Type of a table sample
+         */
+        typedef typename WaveformSample<SAMPLE_BITS>::type Sample;
+
+        /**
+         * @brief Type of a waveform table
+         */
+        typedef const Sample *Table;
+
+        /**
+         * @brief Type of the waveform table storage
+         */
+        typedef WaveformArray<Sample, TABLE_SIZE + 1> Array;
+
+        /**
+         * @brief Size of a waveform table.  
+         * 
+         * Waveform tables all have one extra value in order 
+         * to facilitate faster linear interpolation
+         * 
+         */
+        static constexpr unsigned int TableSize = TABLE_SIZE + 1;
+
+        /**
+         * @brief Bit depth of the table samples
+         */
+        static constexpr unsigned int SampleBits = SAMPLE_BITS;
+
+        /**
+         * @brief Number of phase bits used to index the table
+         */
+        static constexpr unsigned int IndexBits = log2(TABLE_SIZE);
+
+        /**
+         * @brief Number of phase bits used to interpolate between table entries
+         * 
+         * 16 bit tables use one bit less, so the difference times the 
+         * fraction always fits in 32 bits
+         */
+        static constexpr unsigned int FractionBits = (SAMPLE_BITS > 8) ? 15 : 16;
+
+        static_assert((1UL << IndexBits) == TABLE_SIZE, "TABLE_SIZE must be a power of two");
+        static_assert(IndexBits + FractionBits <= 32, "TABLE_SIZE is too large");
+
+        static constexpr Array sine = WaveformGenerator::generate<SineShape<SAMPLE_BITS, TABLE_SIZE>, Sample, TableSize>();                  //!< The sine table
+        static constexpr Array triangle = WaveformGenerator::generate<TriangleShape<SAMPLE_BITS, TABLE_SIZE>, Sample, TableSize>();          //!< The triangle table
+        static constexpr Array square = WaveformGenerator::generate<SquareShape<SAMPLE_BITS, TABLE_SIZE>, Sample, TableSize>();              //!< The square table
+        static constexpr Array sawtooth = WaveformGenerator::generate<SawtoothShape<SAMPLE_BITS, TABLE_SIZE>, Sample, TableSize>();          //!< The sawtooth table
+        static constexpr Array asymSine = WaveformGenerator::generate<AsymmetricSineShape<SAMPLE_BITS, TABLE_SIZE>, Sample, TableSize>();    //!< The AsymmetricSine table
+        static constexpr Array invertedAsymSine = 
+            WaveformGenerator::generate<InvertedAsymmetricSineShape<SAMPLE_BITS, TABLE_SIZE>, Sample, TableSize>();                         //!< The InvertedAsymmetricSine table
+        static constexpr Array compoundSine = WaveformGenerator::generate<CompoundSineShape<SAMPLE_BITS, TABLE_SIZE>, Sample, TableSize>();  //!< The CompoundSine table
+
+        /**
+         * @brief Get the table for the supplied waveform
+         * 
+         * @param waveform - The desired waveform
+         * @return Table The waveform's table (sine if the waveform is invalid)
+         */
+        static constexpr Table getTable(LFOWaveform waveform)
+        {
+            return (waveform == LFOWaveform::Triangle) ? triangle.data :
+                   (waveform == LFOWaveform::Square) ? square.data :
+                   (waveform == LFOWaveform::Sawtooth) ? sawtooth.data :
+                   (waveform == LFOWaveform::AsymmetricSine) ? asymSine.data :
+                   (waveform == LFOWaveform::InvertedAsymmetricSine) ? invertedAsymSine.data :
+                   (waveform == LFOWaveform::CompoundSine) ? compoundSine.data :
+                   sine.data;
+        }
+
+        /**
+         * @brief Get a table sample
+         * 
+         * @param table - The waveform table to read from
+         * @param index - The table index (wraps around every TABLE_SIZE entries)
+         * @return uint32_t The sample value
+         */
+        static inline uint32_t getSample(Table table, uint32_t index)
+        {
+            return table[index & (TABLE_SIZE - 1)];
+        }
+
+        /**
+         * @brief Get the linearly interpolated value of a table
+         * 
+         * The upper IndexBits of the 32 bit phase select the table entry 
+         * and the next FractionBits interpolate towards the next entry
+         * 
+         * @param table - The waveform table to read from
+         * @param phase - The 32 bit oscillator phase
+         * @return uint32_t The 24 bit interpolated value
+         */
+        static inline uint32_t interpolate(Table table, uint32_t phase)
+        {
+            uint32_t index = phase >> (32 - IndexBits);
+            int32_t i = static_cast<int32_t>((phase << IndexBits) >> (32 - FractionBits));
+            uint32_t x = table[index];
+            int32_t y = static_cast<int32_t>(table[index + 1]) - static_cast<int32_t>(x);
+            return (x << (24 - SAMPLE_BITS)) + static_cast<uint32_t>((y * i) >> (SAMPLE_BITS + FractionBits - 24));
+        }
+};
+
+template <unsigned int SAMPLE_BITS, unsigned int TABLE_SIZE>
+constexpr typename WaveformTables<SAMPLE_BITS, TABLE_SIZE>::Array WaveformTables<SAMPLE_BITS, TABLE_SIZE>::sine;
+
+template <unsigned int SAMPLE_BITS, unsigned int TABLE_SIZE>
+constexpr typename WaveformTables<SAMPLE_BITS, TABLE_SIZE>::Array WaveformTables<SAMPLE_BITS, TABLE_SIZE>::triangle;
+
+template <unsigned int SAMPLE_BITS, unsigned int TABLE_SIZE>
+constexpr typename WaveformTables<SAMPLE_BITS, TABLE_SIZE>::Array WaveformTables<SAMPLE_BITS, TABLE_SIZE>::square;
+
+template <unsigned int SAMPLE_BITS, unsigned int TABLE_SIZE>
+constexpr typename WaveformTables<SAMPLE_BITS, TABLE_SIZE>::Array WaveformTables<SAMPLE_BITS, TABLE_SIZE>::sawtooth;
+
+template <unsigned int SAMPLE_BITS, unsigned int TABLE_SIZE>
+constexpr typename WaveformTables<SAMPLE_BITS, TABLE_SIZE>::Array WaveformTables<SAMPLE_BITS, TABLE_SIZE>::asymSine;
+
+template <unsigned int SAMPLE_BITS, unsigned int TABLE_SIZE>
+constexpr typename WaveformTables<SAMPLE_BITS, TABLE_SIZE>::Array WaveformTables<SAMPLE_BITS, TABLE_SIZE>::invertedAsymSine;
+
+template <unsigned int SAMPLE_BITS, unsigned int TABLE_SIZE>
+constexpr typename WaveformTables<SAMPLE_BITS, TABLE_SIZE>::Array WaveformTables<SAMPLE_BITS, TABLE_SIZE>::compoundSine;
+
+/**
+ * @brief 16-bit, 1024 point waveform tables (2050 bytes per waveform)
+ */
+typedef WaveformTables<16, 1024> SixteenBitWaveforms;
+
+#endif